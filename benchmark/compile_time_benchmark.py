@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+"""
+Compile-time cost benchmark for static_string.h
+
+Generates one translation unit per (operation, string size) pair, compiles it
+with every requested compiler and records wall time, peak compiler memory and
+the compiler's own time report (-ftime-trace for Clang, -ftime-report for GCC).
+The results are written to a JSON report.
+"""
+
+import argparse
+import json
+import os
+import platform
+import string
+import subprocess
+import sys
+import time
+
+DEFAULT_SIZES = [16, 64, 256, 1024, 4096, 16384, 65536]
+
+ALPHABET = string.ascii_lowercase + string.ascii_uppercase + string.digits
+
+
+def literal(size):
+    return (ALPHABET * (size // len(ALPHABET) + 1))[:size]
+
+
+def numbers(size):
+    """Fifteen digit numbers, one per 16 bytes of requested size."""
+    return [10 ** 14 + (i * 7919 + 104729) % (9 * 10 ** 14) for i in range(max(1, size // 16))]
+
+
+def op_ss(size):
+    return '    constexpr auto s = "%s"_ss;\n' \
+           '    static_assert(s.size() == %d, "");\n' % (literal(size), size)
+
+
+def op_plus(size):
+    return op_ss(size) + \
+        '    constexpr auto r = s + s;\n' \
+        '    static_assert(r.size() == %d, "");\n' % (2 * size)
+
+
+def op_concat(size):
+    return op_ss(size) + \
+        '    constexpr auto r = static_string::make(s, "|", s, "|", s);\n' \
+        '    static_assert(r.size() == %d, "");\n' % (3 * size + 2)
+
+
+def op_find(size):
+    return op_ss(size) + \
+        '    static_assert(s.find("#needle#") == static_string::npos, "");\n' \
+        '    static_assert(s.rfind(\'#\') == static_string::npos, "");\n'
+
+
+def op_substring(size):
+    return op_ss(size) + \
+        '    constexpr auto r = s.substring<%d, %d>();\n' \
+        '    static_assert(r.size() == %d, "");\n' % (size // 4, size - size // 4, size - 2 * (size // 4))
+
+
+def op_hash(size):
+    return op_ss(size) + \
+        '    static_assert(s.hash() != 0, "");\n'
+
+
+def op_itoss(size):
+    body = ''
+    for value in numbers(size):
+        body += '    static_assert(ITOSS(%dLL).size() == 15, "");\n' % value
+    return body
+
+
+def op_sstoi(size):
+    body = ''
+    for value in numbers(size):
+        body += '    static_assert(SSTOI("%d") == %dLL, "");\n' % (value, value)
+    return body
+
+
+def op_lower(size):
+    return op_ss(size) + \
+        '    constexpr auto r = s.lower();\n' \
+        '    static_assert(r.size() == %d, "");\n' % size
+
+
+OPERATIONS = {
+    '_ss': op_ss,
+    '+': op_plus,
+    'concat': op_concat,
+    'find': op_find,
+    'substring': op_substring,
+    'hash': op_hash,
+    'ITOSS': op_itoss,
+    'SSTOI': op_sstoi,
+    'lower': op_lower,
+}
+
+OPERATION_FILE_NAMES = {
+    '_ss': 'literal',
+    '+': 'plus',
+}
+
+
+def generate(path, operation, size):
+    with open(path, 'w') as source:
+        source.write('#include "static_string.h"\n\n')
+        source.write('using namespace snw1;\n\n')
+        source.write('void benchmark() {\n')
+        source.write(OPERATIONS[operation](size))
+        source.write('}\n')
+
+
+def compiler_version(compiler):
+    try:
+        output = subprocess.check_output([compiler, '--version'], stderr=subprocess.STDOUT)
+    except (OSError, subprocess.CalledProcessError):
+        return None
+    return output.decode(errors='replace').splitlines()[0]
+
+
+def is_clang(version):
+    return version is not None and 'clang' in version.lower()
+
+
+def run(command, log_path):
+    """Runs command and returns (exit code, wall time in seconds, peak RSS in KiB or None)."""
+    with open(log_path, 'w') as log:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=log, stderr=subprocess.STDOUT)
+        if hasattr(os, 'wait4'):
+            _, status, usage = os.wait4(process.pid, 0)
+            wall_time = time.perf_counter() - start
+            process.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, 'waitstatus_to_exitcode') else status >> 8
+            peak_rss = usage.ru_maxrss // 1024 if sys.platform == 'darwin' else usage.ru_maxrss
+            return process.returncode, wall_time, peak_rss
+        process.wait()
+        return process.returncode, time.perf_counter() - start, None
+
+
+def benchmark(compiler, operations, sizes, args):
+    version = compiler_version(compiler)
+    clang = is_clang(version)
+    name = os.path.basename(compiler)
+    work_dir = os.path.join(args.output_dir, name)
+    os.makedirs(work_dir, exist_ok=True)
+    results = []
+    for operation in operations:
+        for size in sizes:
+            stem = '%s_%d' % (OPERATION_FILE_NAMES.get(operation, operation.lower()), size)
+            source = os.path.join(work_dir, stem + '.cpp')
+            obj = os.path.join(work_dir, stem + '.o')
+            log = os.path.join(work_dir, stem + '.log')
+            generate(source, operation, size)
+            command = [compiler, '-std=' + args.std, '-I', args.header_dir, '-c', source, '-o', obj]
+            command += args.extra_flags
+            command += ['-ftime-trace'] if clang else ['-ftime-report']
+            code, wall_time, peak_rss = run(command, log)
+            trace = os.path.join(work_dir, stem + '.json') if clang else log
+            result = {
+                'compiler': name,
+                'compiler_version': version,
+                'operation': operation,
+                'size': size,
+                'status': 'ok' if code == 0 else 'error',
+                'wall_time_s': round(wall_time, 4),
+                'peak_rss_kb': peak_rss,
+                'time_trace': trace if os.path.exists(trace) else None,
+            }
+            results.append(result)
+            print('%-10s %-10s %6d  %-5s %8.3f s  %s KiB' % (name, operation, size, result['status'],
+                wall_time, peak_rss if peak_rss is not None else '-'))
+            sys.stdout.flush()
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description='static_string.h compile-time cost benchmark')
+    parser.add_argument('--header-dir', required=True, help='directory containing static_string.h')
+    parser.add_argument('--output-dir', required=True, help='directory for generated sources and the report')
+    parser.add_argument('--compilers', default='c++', help='comma separated list of compilers')
+    parser.add_argument('--operations', default=','.join(OPERATIONS), help='comma separated list of operations')
+    parser.add_argument('--sizes', default=','.join(map(str, DEFAULT_SIZES)), help='comma separated list of string sizes')
+    parser.add_argument('--std', default='c++14', help='language standard passed as -std=')
+    parser.add_argument('--extra-flags', default='', help='comma separated list of extra compiler flags')
+    parser.add_argument('--report', default='compile_time_report.json', help='report file name inside the output directory')
+    args = parser.parse_args()
+    args.extra_flags = [flag for flag in args.extra_flags.split(',') if flag]
+
+    operations = [operation for operation in args.operations.split(',') if operation]
+    for operation in operations:
+        if operation not in OPERATIONS:
+            parser.error('unknown operation: %s' % operation)
+    sizes = [int(size) for size in args.sizes.split(',') if size]
+    compilers = [compiler for compiler in args.compilers.split(',') if compiler]
+
+    os.makedirs(args.output_dir, exist_ok=True)
+    results = []
+    for compiler in compilers:
+        results += benchmark(compiler, operations, sizes, args)
+
+    report = {
+        'host': platform.node(),
+        'platform': platform.platform(),
+        'std': args.std,
+        'results': results,
+    }
+    report_path = os.path.join(args.output_dir, args.report)
+    with open(report_path, 'w') as output:
+        json.dump(report, output, indent=2)
+    print('report written to %s' % report_path)
+    return 0 if all(result['status'] == 'ok' for result in results) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
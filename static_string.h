@@ -31,7 +31,37 @@ SOFTWARE.
 
 #include <array>
 #include <string>
+#include <ios>
 #include <limits>
+#include <type_traits>
+#include <utility>
+#include <initializer_list>
+#include <cstring>
+#include <cstdint>
+#include <tuple>
+#include <stdexcept>
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <string_view>
+#define SNW1_STATIC_STRING_HAS_STRING_VIEW
+#endif
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+#define SNW1_STATIC_STRING_HAS_CLASS_NTTP
+#endif
+
+#if !defined(SNW1_STATIC_STRING_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SNW1_STATIC_STRING_HAS_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SNW1_STATIC_STRING_HAS_AVX2
+#endif
+#endif
+
+#if !defined(SNW1_STATIC_STRING_NO_SIMD) && \
+    (defined(_WIN32) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+#define SNW1_STATIC_STRING_HAS_SWAR
+#endif
 
 namespace snw1 {
 
@@ -39,33 +69,119 @@ namespace snw1 {
 #define ITOSW(x) int_to_static_string<(x), wchar_t>()
 #define UTOSS(x) uint_to_static_string<(x), char>()
 #define UTOSW(x) uint_to_static_string<(x), wchar_t>()
+#define FTOSS(...) float_to_static_string<float_to_static_string_length<float>(__VA_ARGS__), float, char>(__VA_ARGS__)
+#define FTOSW(...) float_to_static_string<float_to_static_string_length<float>(__VA_ARGS__), float, wchar_t>(__VA_ARGS__)
+#define DTOSS(...) float_to_static_string<float_to_static_string_length<double>(__VA_ARGS__), double, char>(__VA_ARGS__)
+#define DTOSW(...) float_to_static_string<float_to_static_string_length<double>(__VA_ARGS__), double, wchar_t>(__VA_ARGS__)
 #define SSTOI(x) static_string_to_int((x))
 #define SSTOU(x) static_string_to_uint((x))
+#define SSINTERN(x) static_string_intern([] { return (x); })
+#define SSTABLE(...) make_static_string_table<static_string_table_length(__VA_ARGS__)>(__VA_ARGS__)
+#define SSFORMAT(x) make_static_format<static_string_format_slots((x))>((x))
+#define SSAUTOMATON(...) make_static_string_automaton<static_string_automaton_states(__VA_ARGS__), \
+    static_string_automaton_classes(__VA_ARGS__)>(__VA_ARGS__)
+#define SSTRIE(...) make_static_string_trie<static_string_trie_size(__VA_ARGS__), \
+    static_string_automaton_classes(__VA_ARGS__)>(__VA_ARGS__)
+#define SSREGEX(x) make_static_regex<static_regex_classes((x)), \
+    static_regex_states<static_regex_classes((x))>((x)), static_regex_groups((x))>((x))
+#define SSGLOB(x) make_static_glob<static_regex_classes((x), true), \
+    static_regex_states<static_regex_classes((x), true)>((x), true)>((x))
+#define SSCONFIG(x) make_static_config<static_config_size((x))>((x))
+#define SSUTF8(x) to_utf8<utf8_length((x))>((x))
+#define SSUTF16(x) to_utf16<utf16_length((x))>((x))
+#define SSUTF32(x) to_utf32<utf32_length((x))>((x))
+#define SSROUTER(...) make_static_router<static_router_nodes(__VA_ARGS__), static_router_params(__VA_ARGS__)>(__VA_ARGS__)
 
 template<typename Char, size_t Size> struct basic_static_string;
 
+struct fnv1a_hash {};
+struct xxhash64 {};
+struct wyhash {};
+struct siphash {};
+
+enum class parse_error {
+    none,
+    invalid_argument,
+    out_of_range
+};
+
+template<typename T> struct parse_result {
+    constexpr explicit operator bool() const {
+        return error == parse_error::none;
+    }
+    T value;
+    parse_error error;
+    size_t position; // where parsing stopped, the input length on success
+};
+
 namespace __static_string_detail {
 
 template<size_t ... Indexes>
 struct index_sequence {};
 
-template<size_t Size, size_t ... Indexes>
-struct make_index_sequence : make_index_sequence<Size - 1, Size - 1, Indexes ...> {};
+#if defined(__has_builtin)
+#if __has_builtin(__make_integer_seq)
+#define SNW1_STATIC_STRING_MAKE_INTEGER_SEQ
+#elif __has_builtin(__integer_pack)
+#define SNW1_STATIC_STRING_INTEGER_PACK
+#endif
+#endif
+
+#if defined(SNW1_STATIC_STRING_MAKE_INTEGER_SEQ)
+
+template<typename T, T ... Indexes>
+struct index_sequence_builder {
+    using type = index_sequence<Indexes ...>;
+};
+
+template<size_t Size>
+using make_index_sequence = typename __make_integer_seq<index_sequence_builder, size_t, Size>::type;
+
+#undef SNW1_STATIC_STRING_MAKE_INTEGER_SEQ
+
+#elif defined(SNW1_STATIC_STRING_INTEGER_PACK)
+
+template<size_t Size>
+using make_index_sequence = index_sequence<__integer_pack(Size) ...>;
+
+#undef SNW1_STATIC_STRING_INTEGER_PACK
+
+#else
+
+template<typename Sequence>
+struct index_sequence_builder;
 
 template<size_t ... Indexes>
-struct make_index_sequence<0, Indexes ...> : index_sequence<Indexes ...> {};
+struct index_sequence_builder<std::index_sequence<Indexes ...>> {
+    using type = index_sequence<Indexes ...>;
+};
+
+template<size_t Size>
+using make_index_sequence = typename index_sequence_builder<std::make_index_sequence<Size>>::type;
 
-template<size_t Size, size_t ... Indexes>
-struct make_reverse_index_sequence : make_reverse_index_sequence<Size - 1, Indexes ..., Size - 1> {};
+#endif
+
+template<typename Sequence>
+struct reverse_index_sequence;
 
 template<size_t ... Indexes>
-struct make_reverse_index_sequence<0, Indexes ...> : index_sequence<Indexes ...> {};
+struct reverse_index_sequence<index_sequence<Indexes ...>> {
+    using type = index_sequence<(sizeof ... (Indexes) - 1 - Indexes) ...>;
+};
 
-template<size_t Begin, size_t End, size_t ... Indexes>
-struct make_index_subsequence : make_index_subsequence<Begin, End - 1, End - 1, Indexes ...> {};
+template<size_t Offset, typename Sequence>
+struct offset_index_sequence;
 
-template<size_t Pos, size_t ... Indexes>
-struct make_index_subsequence<Pos, Pos, Indexes ...> : index_sequence<Indexes ...> {};
+template<size_t Offset, size_t ... Indexes>
+struct offset_index_sequence<Offset, index_sequence<Indexes ...>> {
+    using type = index_sequence<(Offset + Indexes) ...>;
+};
+
+template<size_t Size>
+using make_reverse_index_sequence = typename reverse_index_sequence<make_index_sequence<Size>>::type;
+
+template<size_t Begin, size_t End>
+using make_index_subsequence = typename offset_index_sequence<Begin, make_index_sequence<End - Begin>>::type;
 
 template<typename Char, Char ... Chars>
 struct char_sequence {};
@@ -132,12 +248,19 @@ constexpr int compare(
     const basic_static_string<Char, Size1>& str1, size_t index1,
     const basic_static_string<Char, Size2>& str2, size_t index2,
     size_t cur_length, size_t max_length) {
-    return cur_length > max_length || (index1 >= Size1 && index2 >= Size2) ? 0 :
-        index1 >= Size1 ? -1 :
-        index2 >= Size2 ? 1 :
-        str1.data[index1] > str2.data[index2] ? 1 :
-        str1.data[index1] < str2.data[index2] ? -1 :
-        compare(str1, index1 + 1, str2, index2 + 1, cur_length + 1, max_length);
+    for (; cur_length <= max_length; ++index1, ++index2, ++cur_length) {
+        if (index1 >= Size1 && index2 >= Size2)
+            return 0;
+        if (index1 >= Size1)
+            return -1;
+        if (index2 >= Size2)
+            return 1;
+        if (str1.data[index1] > str2.data[index2])
+            return 1;
+        if (str1.data[index1] < str2.data[index2])
+            return -1;
+    }
+    return 0;
 }
 
 template<typename Char, size_t Size1, size_t Size2>
@@ -187,21 +310,236 @@ constexpr auto concat(Arg&& arg, Args&& ... args) {
 
 template<typename Char, size_t Size>
 constexpr unsigned long long hash(const basic_static_string<Char, Size>& str, size_t index) {
-    return index >= Size - 1 ? 5381ULL :
-        hash(str, index + 1) * 33ULL + static_cast<unsigned long long>(str.data[index] + 1);
+    unsigned long long result = 5381ULL;
+    for (size_t i = Size - 1; i > index; --i)
+        result = result * 33ULL + static_cast<unsigned long long>(str.data[i - 1] + 1);
+    return result;
+}
+
+template<typename Char>
+struct value_reader {
+    constexpr unsigned long long byte(size_t index) const {
+        return static_cast<unsigned long long>(static_cast<typename std::make_unsigned<Char>::type>(
+            str[index / sizeof(Char)])) >> (8 * (index % sizeof(Char))) & 0xffULL;
+    }
+    constexpr unsigned long long read32(size_t index) const {
+        return byte(index) | byte(index + 1) << 8 | byte(index + 2) << 16 | byte(index + 3) << 24;
+    }
+    constexpr unsigned long long read64(size_t index) const {
+        return read32(index) | read32(index + 4) << 32;
+    }
+    const Char* str;
+};
+
+template<typename Char>
+struct memory_reader {
+    unsigned long long byte(size_t index) const {
+        return reinterpret_cast<const unsigned char*>(str)[index];
+    }
+    unsigned long long read32(size_t index) const {
+        std::uint32_t result = 0;
+        std::memcpy(&result, reinterpret_cast<const unsigned char*>(str) + index, sizeof(result));
+        return result;
+    }
+    unsigned long long read64(size_t index) const {
+        std::uint64_t result = 0;
+        std::memcpy(&result, reinterpret_cast<const unsigned char*>(str) + index, sizeof(result));
+        return result;
+    }
+    const Char* str;
+};
+
+// word loads give the same little-endian byte order as value_reader only on little-endian targets
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || \
+    defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM) || defined(_M_ARM64)
+template<typename Char> using runtime_reader = memory_reader<Char>;
+#else
+template<typename Char> using runtime_reader = value_reader<Char>;
+#endif
+
+constexpr unsigned long long rotl(unsigned long long value, int shift) {
+    return value << shift | value >> (64 - shift);
+}
+
+template<typename Reader>
+constexpr unsigned long long hash(fnv1a_hash, const Reader& reader, size_t size,
+    unsigned long long seed, unsigned long long) {
+    unsigned long long result = 0xcbf29ce484222325ULL ^ seed;
+    for (size_t i = 0; i < size; ++i) {
+        result ^= reader.byte(i);
+        result *= 0x100000001b3ULL;
+    }
+    return result;
+}
+
+constexpr unsigned long long xxh64_prime1 = 0x9e3779b185ebca87ULL;
+constexpr unsigned long long xxh64_prime2 = 0xc2b2ae3d27d4eb4fULL;
+constexpr unsigned long long xxh64_prime3 = 0x165667b19e3779f9ULL;
+constexpr unsigned long long xxh64_prime4 = 0x85ebca77c2b2ae63ULL;
+constexpr unsigned long long xxh64_prime5 = 0x27d4eb2f165667c5ULL;
+
+constexpr unsigned long long xxh64_round(unsigned long long acc, unsigned long long input) {
+    return rotl(acc + input * xxh64_prime2, 31) * xxh64_prime1;
+}
+
+constexpr unsigned long long xxh64_merge(unsigned long long acc, unsigned long long value) {
+    return (acc ^ xxh64_round(0, value)) * xxh64_prime1 + xxh64_prime4;
+}
+
+template<typename Reader>
+constexpr unsigned long long hash(xxhash64, const Reader& reader, size_t size,
+    unsigned long long seed, unsigned long long) {
+    unsigned long long result = seed + xxh64_prime5;
+    size_t i = 0;
+    if (size >= 32) {
+        unsigned long long v1 = seed + xxh64_prime1 + xxh64_prime2, v2 = seed + xxh64_prime2,
+            v3 = seed, v4 = seed - xxh64_prime1;
+        for (; i + 32 <= size; i += 32) {
+            v1 = xxh64_round(v1, reader.read64(i));
+            v2 = xxh64_round(v2, reader.read64(i + 8));
+            v3 = xxh64_round(v3, reader.read64(i + 16));
+            v4 = xxh64_round(v4, reader.read64(i + 24));
+        }
+        result = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        result = xxh64_merge(result, v1);
+        result = xxh64_merge(result, v2);
+        result = xxh64_merge(result, v3);
+        result = xxh64_merge(result, v4);
+    }
+    result += size;
+    for (; i + 8 <= size; i += 8)
+        result = rotl(result ^ xxh64_round(0, reader.read64(i)), 27) * xxh64_prime1 + xxh64_prime4;
+    if (i + 4 <= size) {
+        result = rotl(result ^ reader.read32(i) * xxh64_prime1, 23) * xxh64_prime2 + xxh64_prime3;
+        i += 4;
+    }
+    for (; i < size; ++i)
+        result = rotl(result ^ reader.byte(i) * xxh64_prime5, 11) * xxh64_prime1;
+    result ^= result >> 33;
+    result *= xxh64_prime2;
+    result ^= result >> 29;
+    result *= xxh64_prime3;
+    result ^= result >> 32;
+    return result;
+}
+
+constexpr unsigned long long wyhash_secret0 = 0xa0761d6478bd642fULL;
+constexpr unsigned long long wyhash_secret1 = 0xe7037ed1a0b428dbULL;
+constexpr unsigned long long wyhash_secret2 = 0x8ebc6af09c88c6e3ULL;
+constexpr unsigned long long wyhash_secret3 = 0x589965cc75374cc3ULL;
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 uint128;
+
+constexpr unsigned long long wymix(unsigned long long a, unsigned long long b) {
+    return static_cast<unsigned long long>(static_cast<uint128>(a) * b) ^
+        static_cast<unsigned long long>(static_cast<uint128>(a) * b >> 64);
+}
+#else
+constexpr unsigned long long wymix(unsigned long long a, unsigned long long b) {
+    const unsigned long long ha = a >> 32, hb = b >> 32, la = a & 0xffffffffULL, lb = b & 0xffffffffULL;
+    const unsigned long long hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+    const unsigned long long middle = (ll >> 32) + (hl & 0xffffffffULL) + (lh & 0xffffffffULL);
+    const unsigned long long low = (middle << 32) | (ll & 0xffffffffULL);
+    const unsigned long long high = hh + (hl >> 32) + (lh >> 32) + (middle >> 32);
+    return low ^ high;
+}
+#endif
+
+// wyhash final version 3
+template<typename Reader>
+constexpr unsigned long long hash(wyhash, const Reader& reader, size_t size,
+    unsigned long long seed, unsigned long long) {
+    seed ^= wyhash_secret0;
+    unsigned long long a = 0, b = 0;
+    if (size <= 16) {
+        if (size >= 4) {
+            a = reader.read32(0) << 32 | reader.read32((size >> 3) << 2);
+            b = reader.read32(size - 4) << 32 | reader.read32(size - 4 - ((size >> 3) << 2));
+        } else if (size > 0) {
+            a = reader.byte(0) << 16 | reader.byte(size >> 1) << 8 | reader.byte(size - 1);
+        }
+    } else {
+        size_t i = 0, left = size;
+        if (left > 48) {
+            unsigned long long seed1 = seed, seed2 = seed;
+            do {
+                seed = wymix(reader.read64(i) ^ wyhash_secret1, reader.read64(i + 8) ^ seed);
+                seed1 = wymix(reader.read64(i + 16) ^ wyhash_secret2, reader.read64(i + 24) ^ seed1);
+                seed2 = wymix(reader.read64(i + 32) ^ wyhash_secret3, reader.read64(i + 40) ^ seed2);
+                i += 48;
+                left -= 48;
+            } while (left > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        for (; left > 16; i += 16, left -= 16)
+            seed = wymix(reader.read64(i) ^ wyhash_secret1, reader.read64(i + 8) ^ seed);
+        a = reader.read64(i + left - 16);
+        b = reader.read64(i + left - 8);
+    }
+    return wymix(wyhash_secret1 ^ size, wymix(a ^ wyhash_secret1, b ^ seed));
+}
+
+constexpr void sipround(unsigned long long& v0, unsigned long long& v1, unsigned long long& v2, unsigned long long& v3) {
+    v0 += v1;
+    v1 = rotl(v1, 13) ^ v0;
+    v0 = rotl(v0, 32);
+    v2 += v3;
+    v3 = rotl(v3, 16) ^ v2;
+    v0 += v3;
+    v3 = rotl(v3, 21) ^ v0;
+    v2 += v1;
+    v1 = rotl(v1, 17) ^ v2;
+    v2 = rotl(v2, 32);
+}
+
+// SipHash-2-4 keyed with key0 (bytes 0-7) and key1 (bytes 8-15)
+template<typename Reader>
+constexpr unsigned long long hash(siphash, const Reader& reader, size_t size,
+    unsigned long long key0, unsigned long long key1) {
+    unsigned long long v0 = key0 ^ 0x736f6d6570736575ULL, v1 = key1 ^ 0x646f72616e646f6dULL,
+        v2 = key0 ^ 0x6c7967656e657261ULL, v3 = key1 ^ 0x7465646279746573ULL;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const unsigned long long word = reader.read64(i);
+        v3 ^= word;
+        sipround(v0, v1, v2, v3);
+        sipround(v0, v1, v2, v3);
+        v0 ^= word;
+    }
+    unsigned long long last = static_cast<unsigned long long>(size) << 56;
+    for (size_t shift = 0; i < size; ++i, shift += 8)
+        last |= reader.byte(i) << shift;
+    v3 ^= last;
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    v0 ^= last;
+    v2 ^= 0xff;
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    return v0 ^ v1 ^ v2 ^ v3;
 }
 
 template<typename Char, size_t Size>
 constexpr size_t count(const basic_static_string<Char, Size>& str, Char ch, size_t index) {
-    return index >= Size - 1 ? 0 :
-        (str.data[index] == ch ? 1 : 0) + count(str, ch, index + 1);
+    size_t result = 0;
+    for (; index < Size - 1; ++index)
+        if (str.data[index] == ch)
+            ++result;
+    return result;
 }
 
 template<typename Char, size_t Size>
 constexpr long long to_int(const basic_static_string<Char, Size>& str, size_t index, size_t first) {
-    return index < first || index >= Size - 1 ? 0 :
-        first == 0 ? (str.data[index] - static_cast<Char>('0')) + 10LL * to_int(str, index - 1, first) :
-        -(str.data[index] - static_cast<Char>('0')) + 10LL * to_int(str, index - 1, first);
+    long long result = 0;
+    if (index >= Size - 1)
+        return result;
+    for (size_t i = first; i <= index; ++i)
+        result = first == 0 ? 10LL * result + (str.data[i] - static_cast<Char>('0')) :
+            10LL * result - (str.data[i] - static_cast<Char>('0'));
+    return result;
 }
 
 template<typename Char, size_t Size>
@@ -213,13 +551,17 @@ constexpr long long to_int(const basic_static_string<Char, Size>& str) {
 
 template<typename Char, size_t Size>
 constexpr unsigned long long to_uint(const basic_static_string<Char, Size>& str, size_t index) {
-    return Size < 2 || index >= Size - 1 ? 0 :
-        (str.data[index] - static_cast<Char>('0')) + 10ULL * to_uint(str, index - 1);
+    unsigned long long result = 0;
+    if (Size < 2 || index >= Size - 1)
+        return result;
+    for (size_t i = 0; i <= index; ++i)
+        result = 10ULL * result + (str.data[i] - static_cast<Char>('0'));
+    return result;
 }
 
-template<typename Char, size_t Size>
-std::basic_string<Char> to_string(const basic_static_string<Char, Size>& str) {
-    return std::basic_string<Char>(str.data.data());
+template<typename Char, typename Traits, typename Alloc, size_t Size>
+std::basic_string<Char, Traits, Alloc> to_string(const basic_static_string<Char, Size>& str, const Alloc& alloc) {
+    return std::basic_string<Char, Traits, Alloc>(&str.data[0], Size - 1, alloc);
 }
 
 template<typename Char>
@@ -234,6 +576,530 @@ constexpr Char upper(Char ch) {
         ch - static_cast<Char>('a') + static_cast<Char>('A');
 }
 
+template<typename Char>
+constexpr bool iequal(const Char* str1, size_t length1, const Char* str2, size_t length2) {
+    if (length1 != length2)
+        return false;
+    for (size_t i = 0; i < length1; ++i)
+        if (lower(str1[i]) != lower(str2[i]))
+            return false;
+    return true;
+}
+
+template<typename Char>
+constexpr int icompare(const Char* str1, size_t length1, const Char* str2, size_t length2) {
+    for (size_t i = 0; i < length1 && i < length2; ++i) {
+        const Char ch1 = lower(str1[i]), ch2 = lower(str2[i]);
+        if (ch1 != ch2)
+            return ch1 < ch2 ? -1 : 1;
+    }
+    return length1 < length2 ? -1 : length1 > length2 ? 1 : 0;
+}
+
+template<typename Char>
+constexpr size_t ifind(const Char* str, size_t length, const Char* substr, size_t sublength, size_t from) {
+    for (size_t i = from; i + sublength <= length; ++i)
+        if (iequal(str + i, sublength, substr, sublength))
+            return i;
+    return std::numeric_limits<size_t>::max();
+}
+
+// same polynomial as hash() over the lower case characters
+template<typename Char>
+constexpr unsigned long long ihash(const Char* str, size_t length) {
+    unsigned long long result = 5381ULL;
+    for (size_t i = length; i > 0; --i)
+        result = result * 33ULL + static_cast<unsigned long long>(lower(str[i - 1]) + 1);
+    return result;
+}
+
+// branchless lower() for the runtime paths
+template<typename Char>
+inline Char fold(Char ch) {
+    return static_cast<Char>(ch | static_cast<Char>(static_cast<unsigned long long>(ch) - 'A' < 26ULL ? 0x20 : 0));
+}
+
+struct identity_fold {
+    template<typename Char> Char operator()(Char ch) const {
+        return ch;
+    }
+};
+
+struct ascii_fold {
+    template<typename Char> Char operator()(Char ch) const {
+        return fold(ch);
+    }
+};
+
+#ifdef SNW1_STATIC_STRING_HAS_SWAR
+inline unsigned long long load_eight(const char* str) {
+    unsigned long long result;
+    std::memcpy(&result, str, sizeof(result));
+    return result;
+}
+
+// the high bit of a byte is set by +0x3F from 'A' on and by +0x25 from 'Z' + 1 on,
+// bytes with the high bit already set are not letters
+inline unsigned long long fold_eight(unsigned long long chunk) {
+    const unsigned long long ascii = chunk & 0x7F7F7F7F7F7F7F7FULL;
+    const unsigned long long letters = (ascii + 0x3F3F3F3F3F3F3F3FULL) ^ (ascii + 0x2525252525252525ULL);
+    return chunk | ((letters & ~chunk & 0x8080808080808080ULL) >> 2);
+}
+#endif
+
+#ifdef SNW1_STATIC_STRING_HAS_SSE2
+// 'A'..'Z' are moved to the bottom of the signed range so that one compare finds them
+inline __m128i fold_sixteen(__m128i chunk) {
+    const __m128i shifted = _mm_add_epi8(chunk, _mm_set1_epi8(static_cast<char>(0x80 - 'A')));
+    const __m128i letters = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + 26)));
+    return _mm_or_si128(chunk, _mm_and_si128(letters, _mm_set1_epi8(0x20)));
+}
+#endif
+
+template<typename Char>
+inline bool iequal_runtime(const Char* str1, const Char* str2, size_t length) {
+    for (size_t i = 0; i < length; ++i)
+        if (fold(str1[i]) != fold(str2[i]))
+            return false;
+    return true;
+}
+
+inline bool iequal_runtime(const char* str1, const char* str2, size_t length) {
+    size_t i = 0;
+#ifdef SNW1_STATIC_STRING_HAS_SSE2
+    for (; i + 16 <= length; i += 16) {
+        const __m128i chunk1 = fold_sixteen(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str1 + i)));
+        const __m128i chunk2 = fold_sixteen(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str2 + i)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, chunk2)) != 0xFFFF)
+            return false;
+    }
+#endif
+#ifdef SNW1_STATIC_STRING_HAS_SWAR
+    for (; i + 8 <= length; i += 8)
+        if (fold_eight(load_eight(str1 + i)) != fold_eight(load_eight(str2 + i)))
+            return false;
+#endif
+    for (; i < length; ++i)
+        if (fold(str1[i]) != fold(str2[i]))
+            return false;
+    return true;
+}
+
+template<typename Char>
+inline int icompare_runtime(const Char* str1, size_t length1, const Char* str2, size_t length2) {
+    for (size_t i = 0; i < length1 && i < length2; ++i) {
+        const Char ch1 = fold(str1[i]), ch2 = fold(str2[i]);
+        if (ch1 != ch2)
+            return ch1 < ch2 ? -1 : 1;
+    }
+    return length1 < length2 ? -1 : length1 > length2 ? 1 : 0;
+}
+
+template<typename Char>
+constexpr unsigned digit_value(Char ch) {
+    return ch >= static_cast<Char>('0') && ch <= static_cast<Char>('9') ? static_cast<unsigned>(ch - static_cast<Char>('0')) :
+        ch >= static_cast<Char>('a') && ch <= static_cast<Char>('z') ? static_cast<unsigned>(ch - static_cast<Char>('a')) + 10 :
+        ch >= static_cast<Char>('A') && ch <= static_cast<Char>('Z') ? static_cast<unsigned>(ch - static_cast<Char>('A')) + 10 : 36;
+}
+
+// skips the sign and the 0x/0b prefix, radix 0 picks 16, 2, 8 for a leading 0 or 10 from the prefix
+template<typename Char>
+constexpr size_t parse_prefix(const Char* str, size_t length, unsigned& radix, bool& negative) {
+    size_t i = 0;
+    negative = false;
+    if (i < length && (str[i] == static_cast<Char>('-') || str[i] == static_cast<Char>('+')))
+        negative = str[i++] == static_cast<Char>('-');
+    const Char prefix = i + 2 < length && str[i] == static_cast<Char>('0') ? lower(str[i + 1]) : Char();
+    if ((radix == 0 || radix == 16) && prefix == static_cast<Char>('x') && digit_value(str[i + 2]) < 16) {
+        radix = 16;
+        return i + 2;
+    }
+    if ((radix == 0 || radix == 2) && prefix == static_cast<Char>('b') && digit_value(str[i + 2]) < 2) {
+        radix = 2;
+        return i + 2;
+    }
+    if (radix == 0)
+        radix = i + 1 < length && str[i] == static_cast<Char>('0') ? 8 : 10;
+    return i;
+}
+
+// continues from position with the value of the digits in [first, position)
+template<typename T, typename Char>
+constexpr parse_result<T> parse_digits(const Char* str, size_t length, size_t first, size_t position,
+    unsigned radix, bool negative, unsigned long long value) {
+    if (negative && !std::is_signed<T>::value)
+        return {T(), parse_error::invalid_argument, 0};
+    if (first == length)
+        return {T(), parse_error::invalid_argument, first};
+    const unsigned long long limit = negative ? static_cast<unsigned long long>(std::numeric_limits<T>::max()) + 1 :
+        static_cast<unsigned long long>(std::numeric_limits<T>::max());
+    if (value > limit)
+        return {T(), parse_error::out_of_range, position};
+    for (; position < length; ++position) {
+        const unsigned digit = digit_value(str[position]);
+        if (digit >= radix)
+            return {T(), parse_error::invalid_argument, position};
+        if (value > (limit - digit) / radix)
+            return {T(), parse_error::out_of_range, position};
+        value = value * radix + digit;
+    }
+    return {negative ? static_cast<T>(0ULL - value) : static_cast<T>(value), parse_error::none, length};
+}
+
+template<typename T, typename Char>
+constexpr parse_result<T> parse_integer(const Char* str, size_t length, int radix) {
+    if (radix < 0 || radix == 1 || radix > 36)
+        return {T(), parse_error::invalid_argument, 0};
+    bool negative = false;
+    unsigned base = static_cast<unsigned>(radix);
+    const size_t first = parse_prefix(str, length, base, negative);
+    return parse_digits<T>(str, length, first, first, base, negative, 0);
+}
+
+template<size_t Words> struct big_integer {
+    std::uint32_t words[Words]; // least significant first
+    size_t size; // words up to the most significant non-zero one
+};
+
+template<size_t Words>
+constexpr void trim(big_integer<Words>& number) {
+    while (number.size > 0 && number.words[number.size - 1] == 0)
+        --number.size;
+}
+
+template<size_t Words>
+constexpr big_integer<Words> make_big_integer(unsigned long long value, int shift) {
+    big_integer<Words> result{};
+    const size_t word = static_cast<size_t>(shift / 32), bits = static_cast<size_t>(shift % 32);
+    result.words[word] = static_cast<std::uint32_t>(value << bits);
+    result.size = word + 1;
+    for (value = bits == 0 ? value >> 32 : value >> (32 - bits); value != 0; value >>= 32)
+        result.words[result.size++] = static_cast<std::uint32_t>(value);
+    trim(result);
+    return result;
+}
+
+template<size_t Words>
+constexpr void multiply(big_integer<Words>& number, std::uint32_t factor, std::uint32_t addend = 0) {
+    unsigned long long carry = addend;
+    for (size_t i = 0; i < number.size; ++i) {
+        carry += static_cast<unsigned long long>(number.words[i]) * factor;
+        number.words[i] = static_cast<std::uint32_t>(carry);
+        carry >>= 32;
+    }
+    if (carry != 0)
+        number.words[number.size++] = static_cast<std::uint32_t>(carry);
+}
+
+template<size_t Words>
+constexpr void multiply_power10(big_integer<Words>& number, int exponent) {
+    for (; exponent >= 9; exponent -= 9)
+        multiply(number, 1000000000);
+    for (; exponent > 0; --exponent)
+        multiply(number, 10);
+}
+
+template<size_t Words>
+constexpr std::uint32_t divide(big_integer<Words>& number, std::uint32_t divisor) {
+    unsigned long long remainder = 0;
+    for (size_t i = number.size; i > 0; --i) {
+        remainder = remainder << 32 | number.words[i - 1];
+        number.words[i - 1] = static_cast<std::uint32_t>(remainder / divisor);
+        remainder %= divisor;
+    }
+    trim(number);
+    return static_cast<std::uint32_t>(remainder);
+}
+
+template<size_t Words>
+constexpr big_integer<Words> add(const big_integer<Words>& number1, const big_integer<Words>& number2) {
+    big_integer<Words> result{};
+    unsigned long long carry = 0;
+    result.size = number1.size > number2.size ? number1.size : number2.size;
+    for (size_t i = 0; i < result.size; ++i) {
+        carry += static_cast<unsigned long long>(number1.words[i]) + number2.words[i];
+        result.words[i] = static_cast<std::uint32_t>(carry);
+        carry >>= 32;
+    }
+    if (carry != 0)
+        result.words[result.size++] = static_cast<std::uint32_t>(carry);
+    return result;
+}
+
+// number1 must not be smaller than number2
+template<size_t Words>
+constexpr void subtract(big_integer<Words>& number1, const big_integer<Words>& number2) {
+    long long borrow = 0;
+    for (size_t i = 0; i < number1.size; ++i) {
+        borrow += static_cast<long long>(number1.words[i]) - (i < number2.size ? number2.words[i] : 0);
+        number1.words[i] = static_cast<std::uint32_t>(borrow);
+        borrow = borrow < 0 ? -1 : 0;
+    }
+    trim(number1);
+}
+
+template<size_t Words>
+constexpr int compare(const big_integer<Words>& number1, const big_integer<Words>& number2) {
+    if (number1.size != number2.size)
+        return number1.size < number2.size ? -1 : 1;
+    for (size_t i = number1.size; i > 0; --i)
+        if (number1.words[i - 1] != number2.words[i - 1])
+            return number1.words[i - 1] < number2.words[i - 1] ? -1 : 1;
+    return 0;
+}
+
+template<size_t Words>
+constexpr void shift_left(big_integer<Words>& number, size_t shift) {
+    const size_t word = shift / 32, bits = shift % 32;
+    if (number.size == 0)
+        return;
+    number.words[number.size + word] = 0;
+    for (size_t i = number.size; i > 0; --i) {
+        number.words[i + word] |= bits == 0 ? 0 : number.words[i - 1] >> (32 - bits);
+        number.words[i - 1 + word] = number.words[i - 1] << bits;
+    }
+    for (size_t i = 0; i < word; ++i)
+        number.words[i] = 0;
+    number.size += word + 1;
+    trim(number);
+}
+
+template<size_t Words>
+constexpr void halve(big_integer<Words>& number) {
+    for (size_t i = 0; i < number.size; ++i)
+        number.words[i] = number.words[i] >> 1 | (i + 1 < number.size ? number.words[i + 1] << 31 : 0);
+    trim(number);
+}
+
+template<size_t Words>
+constexpr size_t bit_length(const big_integer<Words>& number) {
+    size_t result = number.size * 32;
+    for (std::uint32_t top = number.size == 0 ? 1U << 31 : number.words[number.size - 1]; (top & 1U << 31) == 0; top <<= 1)
+        --result;
+    return result;
+}
+
+template<typename T>
+constexpr int float_min_exponent() {
+    return std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits;
+}
+
+struct decimal_number {
+    unsigned long long mantissa;
+    long exponent;
+    bool negative;
+    bool truncated; // non-zero digits past the 19th were dropped
+    bool infinity;
+    bool nan;
+    parse_error error;
+    size_t position;
+    size_t digits; // end of the digits and the decimal point, which start after the sign
+    long power; // the exponent after e
+};
+
+template<typename Char>
+constexpr bool equal_lower(const Char* str, size_t length, const char* word) {
+    size_t i = 0;
+    for (; i < length && word[i] != '\0'; ++i)
+        if (lower(str[i]) != static_cast<Char>(word[i]))
+            return false;
+    return i == length && word[i] == '\0';
+}
+
+// [+-] digits [. digits] [e [+-] digits], inf, infinity or nan
+template<typename Char>
+constexpr decimal_number scan_decimal(const Char* str, size_t length) {
+    decimal_number result{0, 0, false, false, false, false, parse_error::none, length, 0, 0};
+    size_t i = 0;
+    if (i < length && (str[i] == static_cast<Char>('-') || str[i] == static_cast<Char>('+')))
+        result.negative = str[i++] == static_cast<Char>('-');
+    if (equal_lower(str + i, length - i, "inf") || equal_lower(str + i, length - i, "infinity")) {
+        result.infinity = true;
+        return result;
+    }
+    if (equal_lower(str + i, length - i, "nan")) {
+        result.nan = true;
+        return result;
+    }
+    size_t digits = 0;
+    for (bool fraction = false; i < length; ++i) {
+        if (str[i] == static_cast<Char>('.') && !fraction) {
+            fraction = true;
+            continue;
+        }
+        const unsigned digit = digit_value(str[i]);
+        if (digit > 9)
+            break;
+        ++digits;
+        result.digits = i + 1;
+        if (result.mantissa < 1000000000000000000ULL) {
+            result.mantissa = result.mantissa * 10 + digit;
+            result.exponent -= fraction ? 1 : 0;
+        } else {
+            result.exponent += fraction ? 0 : 1;
+            result.truncated = result.truncated || digit != 0;
+        }
+    }
+    if (digits > 0 && i < length && (str[i] == static_cast<Char>('e') || str[i] == static_cast<Char>('E'))) {
+        const bool negative = i + 1 < length && str[i + 1] == static_cast<Char>('-');
+        size_t j = i + 1 < length && (str[i + 1] == static_cast<Char>('-') || str[i + 1] == static_cast<Char>('+')) ? i + 2 : i + 1;
+        const size_t first = j;
+        long exponent = 0;
+        for (; j < length && digit_value(str[j]) <= 9; ++j)
+            exponent = exponent < 100000 ? exponent * 10 + static_cast<long>(digit_value(str[j])) : exponent;
+        if (j > first) {
+            result.power = negative ? -exponent : exponent;
+            result.exponent += result.power;
+            i = j;
+        }
+    }
+    if (digits == 0 || i != length) {
+        result.error = parse_error::invalid_argument;
+        result.position = digits == 0 ? 0 : i;
+    }
+    return result;
+}
+
+constexpr int decimal_magnitude(const decimal_number& number) {
+    int result = 0;
+    for (unsigned long long mantissa = number.mantissa; mantissa > 0; mantissa /= 10)
+        ++result;
+    return result + static_cast<int>(number.exponent);
+}
+
+// significant digits that can decide the rounding, the halfway points between denormals have as many
+template<typename T>
+constexpr int float_digit_limit() {
+    return -float_min_exponent<T>() * 7 / 10 + std::numeric_limits<T>::digits10 + 4;
+}
+
+// enough bits for the digits times the largest power of ten and for the power of ten below the smallest denormal
+template<typename T>
+constexpr size_t decimal_words() {
+    return static_cast<size_t>((float_digit_limit<T>() - std::numeric_limits<T>::min_exponent10 > std::numeric_limits<T>::max_exponent10 ?
+        float_digit_limit<T>() - std::numeric_limits<T>::min_exponent10 : std::numeric_limits<T>::max_exponent10) +
+        std::numeric_limits<T>::digits10 + 8) * 3322 / 1000 / 32 + static_cast<size_t>(std::numeric_limits<T>::digits) / 16 + 4;
+}
+
+// fraction * 2^exponent, exact in constexpr without bit casts when the result is representable
+template<typename T>
+constexpr T compose(unsigned long long fraction, int exponent) {
+    const T step = static_cast<T>(1ULL << 63) * 2;
+    T result = static_cast<T>(fraction);
+    for (; exponent >= 64; exponent -= 64)
+        result *= step;
+    for (; exponent <= -64; exponent += 64)
+        result /= step;
+    return exponent >= 0 ? result * static_cast<T>(1ULL << exponent) : result / static_cast<T>(1ULL << -exponent);
+}
+
+// correctly rounded, half to even: divides all the significant digits times a power of ten into
+// a fraction of digits bits (fewer for denormals) and compares twice the remainder with the divisor
+template<typename T, typename Char>
+constexpr parse_result<T> decimal_to_floating(const Char* str, const decimal_number& number) {
+    constexpr size_t Words = decimal_words<T>();
+    constexpr int Digits = std::numeric_limits<T>::digits;
+    if (number.error != parse_error::none)
+        return {T(), number.error, number.position};
+    if (number.nan)
+        return {std::numeric_limits<T>::quiet_NaN(), parse_error::none, number.position};
+    if (number.infinity)
+        return {number.negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity(),
+            parse_error::none, number.position};
+    if (number.mantissa == 0)
+        return {number.negative ? -T() : T(), parse_error::none, number.position};
+    const int magnitude = decimal_magnitude(number);
+    if (magnitude > std::numeric_limits<T>::max_exponent10 + 1 ||
+        magnitude < std::numeric_limits<T>::min_exponent10 - std::numeric_limits<T>::digits10 - 2)
+        return {T(), parse_error::out_of_range, number.position};
+    big_integer<Words> scaled{};
+    long exponent = number.power;
+    bool inexact = false; // non-zero digits past the limit were dropped
+    int count = 0;
+    for (size_t i = str[0] == static_cast<Char>('-') || str[0] == static_cast<Char>('+') ? 1 : 0, fraction = 0; i < number.digits; ++i) {
+        if (str[i] == static_cast<Char>('.')) {
+            fraction = 1;
+            continue;
+        }
+        const unsigned digit = digit_value(str[i]);
+        if (count < float_digit_limit<T>()) {
+            if (count > 0 || digit != 0) {
+                multiply(scaled, 10, digit);
+                ++count;
+            }
+            exponent -= static_cast<long>(fraction);
+        } else {
+            exponent += 1 - static_cast<long>(fraction);
+            inexact = inexact || digit != 0;
+        }
+    }
+    big_integer<Words> divisor = make_big_integer<Words>(1, 0);
+    if (exponent < 0)
+        multiply_power10(divisor, static_cast<int>(-exponent));
+    else
+        multiply_power10(scaled, static_cast<int>(exponent));
+    // scaled / divisor * 2^binary with the quotient of Digits or Digits + 1 bits
+    int binary = 0;
+    const int difference = static_cast<int>(bit_length(scaled)) - static_cast<int>(bit_length(divisor));
+    if (difference < Digits) {
+        shift_left(scaled, static_cast<size_t>(Digits - difference));
+        binary -= Digits - difference;
+    } else {
+        shift_left(divisor, static_cast<size_t>(difference - Digits));
+        binary += difference - Digits;
+    }
+    // divisor * 2^(Digits - 1), doubled when the quotient has Digits + 1 bits
+    shift_left(divisor, Digits);
+    if (compare(scaled, divisor) >= 0)
+        ++binary;
+    else
+        halve(divisor);
+    if (binary < float_min_exponent<T>()) {
+        shift_left(divisor, static_cast<size_t>(float_min_exponent<T>() - binary));
+        binary = float_min_exponent<T>();
+    }
+    unsigned long long fraction = 0;
+    for (int bit = Digits - 1; bit >= 0; --bit) {
+        if (compare(scaled, divisor) >= 0) {
+            subtract(scaled, divisor);
+            fraction |= 1ULL << bit;
+        }
+        if (bit > 0)
+            halve(divisor);
+    }
+    multiply(scaled, 2);
+    const int half = compare(scaled, divisor);
+    if (half > 0 || (half == 0 && (inexact || fraction % 2 == 1))) {
+        if (fraction == (std::numeric_limits<unsigned long long>::max() >> (64 - Digits))) {
+            fraction = 1ULL << (Digits - 1);
+            ++binary;
+        } else {
+            ++fraction;
+        }
+    }
+    if (fraction == 0 || binary > std::numeric_limits<T>::max_exponent - Digits)
+        return {T(), parse_error::out_of_range, number.position};
+    const T result = compose<T>(fraction, binary);
+    return {number.negative ? -result : result, parse_error::none, number.position};
+}
+
+template<typename T, typename Char>
+constexpr parse_result<T> parse_number(const Char* str, size_t length, int radix, std::false_type) {
+    return parse_integer<T>(str, length, radix);
+}
+
+template<typename T, typename Char>
+constexpr parse_result<T> parse_number(const Char* str, size_t length, int radix, std::true_type) {
+    return radix != 10 ? parse_result<T>{T(), parse_error::invalid_argument, 0} :
+        decimal_to_floating<T>(str, scan_decimal(str, length));
+}
+
+template<typename T, typename Char>
+constexpr parse_result<T> parse_number(const Char* str, size_t length, int radix) {
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "T must be an integer or a floating point type");
+    return parse_number<T>(str, length, radix, std::is_floating_point<T>{});
+}
+
 template<typename Char, size_t Size, size_t ... Indexes>
 constexpr basic_static_string<Char, Size> lower(const basic_static_string<Char, Size>& str, index_sequence<Indexes ...>) {
     return {lower(str.data[Indexes]) ...};
@@ -287,27 +1153,37 @@ template<typename Char, size_t Size> struct basic_static_string {
         return substring<Begin, Size - 1>();
     }
     constexpr size_t find(Char ch, size_t from = 0, size_t nth = 0) const {
-        return Size < 2 || from >= Size - 1 ? npos :
-            data[from] != ch ? find(ch, from + 1, nth) :
-            nth > 0 ? find(ch, from + 1, nth - 1) : from;
+        for (; from < Size - 1; ++from)
+            if (data[from] == ch && nth-- == 0)
+                return from;
+        return npos;
     }
     template<size_t SubSize> constexpr size_t find(const basic_static_string<Char, SubSize>& substr, size_t from = 0, size_t nth = 0) const {
-        return Size < SubSize || from > Size - SubSize ? npos :
-            __static_string_detail::compare(*this, from, substr, 0, 1, SubSize - 1) != 0 ? find(substr, from + 1, nth) :
-            nth > 0 ? find(substr, from + 1, nth - 1) : from;
+        if (Size < SubSize)
+            return npos;
+        for (; from <= Size - SubSize; ++from)
+            if (__static_string_detail::compare(*this, from, substr, 0, 1, SubSize - 1) == 0 && nth-- == 0)
+                return from;
+        return npos;
     }
     template<size_t SubSize> constexpr size_t find(const Char (& substr)[SubSize], size_t from = 0, size_t nth = 0) const {
         return find(__static_string_detail::make(substr), from, nth);
     }
     constexpr size_t rfind(Char ch, size_t from = Size - 2, size_t nth = 0) const {
-        return Size < 2 || from > Size - 2 ? npos :
-            data[from] != ch ? rfind(ch, from - 1, nth) :
-            nth > 0 ? rfind(ch, from - 1, nth - 1) : from;
+        if (Size < 2 || from > Size - 2)
+            return npos;
+        for (size_t i = from + 1; i > 0; --i)
+            if (data[i - 1] == ch && nth-- == 0)
+                return i - 1;
+        return npos;
     }
     template<size_t SubSize> constexpr size_t rfind(const basic_static_string<Char, SubSize>& substr, size_t from = Size - SubSize, size_t nth = 0) const {
-        return Size < SubSize || from > Size - SubSize ? npos :
-            __static_string_detail::compare(*this, from, substr, 0, 1, SubSize - 1) != 0 ? rfind(substr, from - 1, nth) :
-            nth > 0 ? rfind(substr, from - 1, nth - 1) : from;
+        if (Size < SubSize || from > Size - SubSize)
+            return npos;
+        for (size_t i = from + 1; i > 0; --i)
+            if (__static_string_detail::compare(*this, i - 1, substr, 0, 1, SubSize - 1) == 0 && nth-- == 0)
+                return i - 1;
+        return npos;
     }
     template<size_t SubSize> constexpr size_t rfind(const Char (& substr)[SubSize], size_t from = Size - SubSize, size_t nth = 0) const {
         return rfind(__static_string_detail::make(substr), from, nth);
@@ -342,6 +1218,54 @@ template<typename Char, size_t Size> struct basic_static_string {
     constexpr unsigned long long hash() const {
         return __static_string_detail::hash(*this, 0);
     }
+    template<typename Algo> constexpr unsigned long long hash(unsigned long long key0 = 0, unsigned long long key1 = 0) const {
+        return __static_string_detail::hash(Algo{}, __static_string_detail::value_reader<Char>{&data[0]},
+            (Size - 1) * sizeof(Char), key0, key1);
+    }
+    constexpr unsigned long long ihash() const {
+        return __static_string_detail::ihash(&data[0], Size - 1);
+    }
+    template<size_t OtherSize> constexpr bool iequals(const basic_static_string<Char, OtherSize>& other) const {
+        return __static_string_detail::iequal(&data[0], Size - 1, &other.data[0], OtherSize - 1);
+    }
+    template<size_t OtherSize> constexpr bool iequals(const Char (& other)[OtherSize]) const {
+        return __static_string_detail::iequal(&data[0], Size - 1, other, OtherSize - 1);
+    }
+    bool iequals(const Char* str, size_t length) const {
+        return length == Size - 1 && __static_string_detail::iequal_runtime(&data[0], str, length);
+    }
+    template<typename Traits, typename Alloc> bool iequals(const std::basic_string<Char, Traits, Alloc>& str) const {
+        return iequals(str.data(), str.size());
+    }
+    template<size_t OtherSize> constexpr int icompare(const basic_static_string<Char, OtherSize>& other) const {
+        return __static_string_detail::icompare(&data[0], Size - 1, &other.data[0], OtherSize - 1);
+    }
+    template<size_t OtherSize> constexpr int icompare(const Char (& other)[OtherSize]) const {
+        return __static_string_detail::icompare(&data[0], Size - 1, other, OtherSize - 1);
+    }
+    int icompare(const Char* str, size_t length) const {
+        return __static_string_detail::icompare_runtime(&data[0], Size - 1, str, length);
+    }
+    template<typename Traits, typename Alloc> int icompare(const std::basic_string<Char, Traits, Alloc>& str) const {
+        return icompare(str.data(), str.size());
+    }
+    constexpr size_t ifind(Char ch, size_t from = 0) const {
+        return __static_string_detail::ifind(&data[0], Size - 1, &ch, 1, from);
+    }
+    template<size_t SubSize> constexpr size_t ifind(const basic_static_string<Char, SubSize>& substr, size_t from = 0) const {
+        return __static_string_detail::ifind(&data[0], Size - 1, &substr.data[0], SubSize - 1, from);
+    }
+    template<size_t SubSize> constexpr size_t ifind(const Char (& substr)[SubSize], size_t from = 0) const {
+        return __static_string_detail::ifind(&data[0], Size - 1, substr, SubSize - 1, from);
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    bool iequals(std::basic_string_view<Char> str) const {
+        return iequals(str.data(), str.size());
+    }
+    int icompare(std::basic_string_view<Char> str) const {
+        return icompare(str.data(), str.size());
+    }
+#endif
     constexpr Char operator[](size_t index) const {
         return data[index];
     }
@@ -349,65 +1273,199 @@ template<typename Char, size_t Size> struct basic_static_string {
         return __static_string_detail::to_int(*this);
     }
     constexpr unsigned long long to_uint() const {
-        return __static_string_detail::to_uint(*this, 0);
+        return __static_string_detail::to_uint(*this, Size - 2);
+    }
+    template<typename T> constexpr parse_result<T> parse(int radix = 10) const {
+        return __static_string_detail::parse_number<T>(&data[0], Size - 1, radix);
+    }
+    std::basic_string<Char> str() const {
+        return __static_string_detail::to_string<Char, std::char_traits<Char>>(*this, std::allocator<Char>{});
+    }
+    template<typename Alloc> std::basic_string<Char, std::char_traits<Char>, Alloc> str(const Alloc& alloc) const {
+        return __static_string_detail::to_string<Char, std::char_traits<Char>>(*this, alloc);
     }
-    std::string str() const {
-        return __static_string_detail::to_string(*this);
+    constexpr const Char* c_str() const {
+        return &data[0];
     }
+    size_t copy(Char* dest, size_t count = npos, size_t pos = 0) const {
+        if (pos > Size - 1)
+            throw std::out_of_range("basic_static_string::copy: pos > size()");
+        const size_t length = count < Size - 1 - pos ? count : Size - 1 - pos;
+        std::char_traits<Char>::copy(dest, &data[pos], length);
+        return length;
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    constexpr std::basic_string_view<Char> view() const {
+        return std::basic_string_view<Char>(&data[0], Size - 1);
+    }
+    constexpr operator std::basic_string_view<Char>() const {
+        return view();
+    }
+#endif
     constexpr auto lower() const {
         return __static_string_detail::lower(*this, __static_string_detail::make_index_sequence<Size>{});
     }
     constexpr auto upper() const {
         return __static_string_detail::upper(*this, __static_string_detail::make_index_sequence<Size>{});
     }
+#ifdef SNW1_STATIC_STRING_HAS_CLASS_NTTP
+    // mutable so that the type is structural and string_literal can fill it in place
+    std::array<Char, Size> data;
+#else
     std::array<const Char, Size> data;
+#endif
 };
 
 template<size_t Size> using static_string_t = basic_static_string<char, Size>;
 template<size_t Size> using static_wstring_t = basic_static_string<wchar_t, Size>;
+template<size_t Size> using static_u16string_t = basic_static_string<char16_t, Size>;
+template<size_t Size> using static_u32string_t = basic_static_string<char32_t, Size>;
+#ifdef __cpp_char8_t
+template<size_t Size> using static_u8string_t = basic_static_string<char8_t, Size>;
+#endif
 
 using static_string = basic_static_string<char, 0>;
 using static_wstring = basic_static_string<wchar_t, 0>;
+using static_u16string = basic_static_string<char16_t, 0>;
+using static_u32string = basic_static_string<char32_t, 0>;
+#ifdef __cpp_char8_t
+using static_u8string = basic_static_string<char8_t, 0>;
+#endif
+
+#ifdef SNW1_STATIC_STRING_HAS_CLASS_NTTP
+namespace __static_string_detail {
+
+// structural literal wrapper, the whole literal is a single template argument instead of a character pack
+template<typename Char, size_t Size>
+struct string_literal {
+    constexpr string_literal(const Char (& str)[Size]) {
+        Char* data = value.data.data();
+        for (size_t i = 0; i < Size; ++i)
+            data[i] = str[i];
+    }
+    basic_static_string<Char, Size> value;
+};
+
+// template parameter objects are unique per value across the program
+template<basic_static_string Str>
+constexpr const auto& object() {
+    return Str;
+}
+
+} // namespace __static_string_detail
 
+template<__static_string_detail::string_literal Str>
+constexpr auto operator"" _ss() {
+    return Str.value;
+}
+#else
 template<typename Char, Char ... Chars>
 constexpr basic_static_string<Char, sizeof ... (Chars) + 1> operator"" _ss() {
     return {Chars ..., static_cast<Char>('\0')};
 };
+#endif
+
+template<typename Char, Char ... Chars> struct static_string_storage {
+    static constexpr basic_static_string<Char, sizeof ... (Chars) + 1> value = {Chars ..., static_cast<Char>('\0')};
+};
+
+#ifndef __cpp_inline_variables
+template<typename Char, Char ... Chars>
+constexpr basic_static_string<Char, sizeof ... (Chars) + 1> static_string_storage<Char, Chars ...>::value;
+#endif
+
+#ifdef SNW1_STATIC_STRING_HAS_CLASS_NTTP
+template<__static_string_detail::string_literal Str>
+constexpr const auto& operator"" _si() {
+    return __static_string_detail::object<Str.value>();
+}
+#else
+template<typename Char, Char ... Chars>
+constexpr const basic_static_string<Char, sizeof ... (Chars) + 1>& operator"" _si() {
+    return static_string_storage<Char, Chars ...>::value;
+};
+#endif
 
 template<typename Char, size_t Size>
-std::basic_ostream<Char>& operator<<(std::basic_ostream<Char>& bos, const basic_static_string<Char, Size>& str) {
-    bos << str.data.data();
+std::basic_string<Char> to_string(const basic_static_string<Char, Size>& str) {
+    return str.str();
+}
+
+template<typename Char, size_t Size, typename Alloc>
+std::basic_string<Char, std::char_traits<Char>, Alloc> to_string(const basic_static_string<Char, Size>& str, const Alloc& alloc) {
+    return str.str(alloc);
+}
+
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+template<typename Char, size_t Size>
+constexpr std::basic_string_view<Char> to_string_view(const basic_static_string<Char, Size>& str) {
+    return str.view();
+}
+#endif
+
+namespace __static_string_detail {
+
+// formatted output of all length characters, embedded '\0' included, padded to width() with fill()
+template<typename Char>
+std::basic_ostream<Char>& write_padded(std::basic_ostream<Char>& bos, const Char* str, size_t length) {
+    using traits = std::char_traits<Char>;
+    const typename std::basic_ostream<Char>::sentry sentry(bos);
+    if (sentry) {
+        const size_t width = bos.width() > 0 ? static_cast<size_t>(bos.width()) : 0;
+        const size_t padding = width > length ? width - length : 0;
+        const bool left = (bos.flags() & std::ios_base::adjustfield) == std::ios_base::left;
+        const Char fill = bos.fill();
+        bool good = true;
+        for (size_t i = 0; i < padding && !left && good; ++i)
+            good = !traits::eq_int_type(bos.rdbuf()->sputc(fill), traits::eof());
+        good = good && bos.rdbuf()->sputn(str, static_cast<std::streamsize>(length)) == static_cast<std::streamsize>(length);
+        for (size_t i = 0; i < padding && left && good; ++i)
+            good = !traits::eq_int_type(bos.rdbuf()->sputc(fill), traits::eof());
+        if (!good)
+            bos.setstate(std::ios_base::badbit);
+    }
+    bos.width(0);
     return bos;
 }
 
+} // namespace __static_string_detail
+
+template<typename Char, size_t Size>
+std::basic_ostream<Char>& operator<<(std::basic_ostream<Char>& bos, const basic_static_string<Char, Size>& str) {
+    // padding needs formatted output, everything else is a single unformatted write
+    if (bos.width() != 0)
+        return __static_string_detail::write_padded(bos, &str.data[0], Size - 1);
+    return bos.write(&str.data[0], Size - 1);
+}
+
 template<typename Char, size_t Size1, size_t Size2>
 constexpr bool operator==(const basic_static_string<Char, Size1>& str1, const basic_static_string<Char, Size2>& str2) {
-    return __static_string_detail::compare(str1, str2) == 0;
+    return Size1 != Size2 ? false : __static_string_detail::compare(str1, str2) == 0;
 }
 
 template<typename Char, size_t Size1, size_t Size2>
 constexpr bool operator==(const basic_static_string<Char, Size1>& str1, const Char (& str2)[Size2]) {
-    return __static_string_detail::compare(str1, str2) == 0;
+    return Size1 != Size2 ? false : __static_string_detail::compare(str1, str2) == 0;
 }
 
 template<typename Char, size_t Size1, size_t Size2>
 constexpr bool operator==(const Char (& str1)[Size1], const basic_static_string<Char, Size2>& str2) {
-    return __static_string_detail::compare(str1, str2) == 0;
+    return Size1 != Size2 ? false : __static_string_detail::compare(str1, str2) == 0;
 }
 
 template<typename Char, size_t Size1, size_t Size2>
 constexpr bool operator!=(const basic_static_string<Char, Size1>& str1, const basic_static_string<Char, Size2>& str2) {
-    return __static_string_detail::compare(str1, str2) != 0;
+    return Size1 != Size2 ? true : __static_string_detail::compare(str1, str2) != 0;
 }
 
 template<typename Char, size_t Size1, size_t Size2>
 constexpr bool operator!=(const basic_static_string<Char, Size1>& str1, const Char (& str2)[Size2]) {
-    return __static_string_detail::compare(str1, str2) != 0;
+    return Size1 != Size2 ? true : __static_string_detail::compare(str1, str2) != 0;
 }
 
 template<typename Char, size_t Size1, size_t Size2>
 constexpr bool operator!=(const Char (& str1)[Size1], const basic_static_string<Char, Size2>& str2) {
-    return __static_string_detail::compare(str1, str2) != 0;
+    return Size1 != Size2 ? true : __static_string_detail::compare(str1, str2) != 0;
 }
 
 template<typename Char, size_t Size1, size_t Size2>
@@ -495,14 +1553,251 @@ constexpr auto uint_to_static_string() {
     return __static_string_detail::make(__static_string_detail::make_uint_char_sequence<Value, Char>{});
 }
 
-template<typename Char, size_t Size>
-constexpr long long static_string_to_int(const basic_static_string<Char, Size>& str) {
-    return __static_string_detail::to_int(str);
-}
+enum class float_format {
+    general, // the shorter of fixed and scientific, fixed on a tie
+    fixed,
+    scientific
+};
 
-template<typename Char, size_t Size>
-constexpr long long static_string_to_int(const Char (& str)[Size]) {
-    return static_string_to_int(__static_string_detail::make(str));
+namespace __static_string_detail {
+
+// compare(add(number1, number2), number3) without the temporary
+template<size_t Words>
+constexpr int compare_sum(const big_integer<Words>& number1, const big_integer<Words>& number2, const big_integer<Words>& number3) {
+    const size_t size = number1.size > number2.size ? (number1.size > number3.size ? number1.size : number3.size) :
+        number2.size > number3.size ? number2.size : number3.size;
+    long long carry = 0;
+    bool zero = true;
+    for (size_t i = 0; i < size; ++i) {
+        carry += static_cast<long long>(i < number1.size ? number1.words[i] : 0) + (i < number2.size ? number2.words[i] : 0) -
+            (i < number3.size ? number3.words[i] : 0);
+        zero = zero && static_cast<std::uint32_t>(carry) == 0;
+        carry >>= 32;
+    }
+    return carry < 0 ? -1 : carry > 0 || !zero ? 1 : 0;
+}
+
+struct float_decimal {
+    char digits[24];
+    int count;
+    int exponent; // the value is 0.digits times 10 to the exponent
+    bool negative;
+    bool infinity;
+    bool nan;
+};
+
+// enough bits for the scaled value and the power of ten of the smallest denormal
+template<typename T>
+constexpr size_t float_words() {
+    return static_cast<size_t>(std::numeric_limits<T>::digits - float_min_exponent<T>() * 34 / 33 + 16) / 32 + 1;
+}
+
+// splits value into fraction * 2^exponent with fraction below 2^digits, exact in constexpr without bit casts
+template<typename T>
+constexpr unsigned long long decompose(T value, int& exponent) {
+    const T top = static_cast<T>(1ULL << (std::numeric_limits<T>::digits - 1)) * 2;
+    const T half = static_cast<T>(1ULL << (std::numeric_limits<T>::digits - 1));
+    const T step = static_cast<T>(1ULL << 32);
+    exponent = 0;
+    for (; value >= top * step; exponent += 32)
+        value /= step;
+    for (; value >= top; ++exponent)
+        value /= 2;
+    for (; value * step < half && exponent - 32 >= float_min_exponent<T>(); exponent -= 32)
+        value *= step;
+    for (; value < half && exponent > float_min_exponent<T>(); --exponent)
+        value *= 2;
+    return static_cast<unsigned long long>(value);
+}
+
+// free-format shortest digits that read back to value (Steele & White, Burger & Dybvig),
+// the closest of them and round half to even on a tie
+template<typename T>
+constexpr float_decimal shortest_decimal(T value) {
+    constexpr size_t Words = float_words<T>();
+    float_decimal result{};
+    if (value != value) {
+        result.nan = true;
+        return result;
+    }
+    result.negative = __builtin_signbit(value) != 0; // -0 too, which compares equal to 0
+    value = value < 0 ? -value : value;
+    if (value > std::numeric_limits<T>::max()) {
+        result.infinity = true;
+        return result;
+    }
+    if (value == 0) {
+        result.digits[0] = '0';
+        result.count = result.exponent = 1;
+        return result;
+    }
+    int exponent = 0;
+    const unsigned long long fraction = decompose(value, exponent);
+    const bool even = fraction % 2 == 0;
+    const bool boundary = fraction == 1ULL << (std::numeric_limits<T>::digits - 1) && exponent > float_min_exponent<T>();
+    const int shift = exponent < 0 ? 0 : exponent;
+    big_integer<Words> r = make_big_integer<Words>(fraction, shift + (boundary ? 2 : 1));
+    big_integer<Words> s = make_big_integer<Words>(boundary ? 4 : 2, exponent < 0 ? -exponent : 0);
+    big_integer<Words> high = make_big_integer<Words>(boundary ? 2 : 1, shift);
+    big_integer<Words> low = make_big_integer<Words>(1, shift);
+    int bits = 0;
+    for (unsigned long long f = fraction; f > 0; f >>= 1)
+        ++bits;
+    const long long magnitude = (exponent + bits - 1) * 1292913986LL; // log10(2) * 2^32
+    int k = magnitude == 0 ? 0 : static_cast<int>(magnitude >= 0 ? magnitude >> 32 : -((-magnitude) >> 32) - 1) + 1;
+    if (k >= 0) {
+        multiply_power10(s, k);
+    } else {
+        multiply_power10(r, -k);
+        multiply_power10(high, -k);
+        multiply_power10(low, -k);
+    }
+    for (int order = compare_sum(r, high, s); even ? order >= 0 : order > 0; order = compare_sum(r, high, s)) {
+        multiply(s, 10);
+        ++k;
+    }
+    for (big_integer<Words> next = add(r, high); multiply(next, 10), even ? compare(next, s) < 0 : compare(next, s) <= 0;
+        next = add(r, high)) {
+        multiply(r, 10);
+        multiply(high, 10);
+        multiply(low, 10);
+        --k;
+    }
+    result.exponent = k;
+    for (;;) {
+        multiply(r, 10);
+        multiply(high, 10);
+        multiply(low, 10);
+        char digit = '0';
+        for (; compare(r, s) >= 0; ++digit)
+            subtract(r, s);
+        const int low_order = compare(r, low), high_order = compare_sum(r, high, s);
+        const bool round_down = even ? low_order <= 0 : low_order < 0;
+        const bool round_up = even ? high_order >= 0 : high_order > 0;
+        if (!round_down && !round_up) {
+            result.digits[result.count++] = digit;
+            continue;
+        }
+        if (round_down && round_up) {
+            const int half = compare_sum(r, r, s);
+            digit += half > 0 || (half == 0 && (digit - '0') % 2 == 1) ? 1 : 0;
+        } else if (round_up) {
+            ++digit;
+        }
+        result.digits[result.count++] = digit;
+        return result;
+    }
+}
+
+template<typename T>
+constexpr size_t float_capacity() {
+    return 48 + static_cast<size_t>(std::numeric_limits<T>::max_exponent10 > 2 - std::numeric_limits<T>::min_exponent10 +
+        std::numeric_limits<T>::digits10 ? std::numeric_limits<T>::max_exponent10 :
+        2 - std::numeric_limits<T>::min_exponent10 + std::numeric_limits<T>::digits10);
+}
+
+// integers too large for the shortest digits are written out in full like printf and std::to_chars do
+template<typename T>
+constexpr int write_integer(T value, char* text) {
+    int exponent = 0;
+    const unsigned long long fraction = decompose(value, exponent);
+    big_integer<float_words<T>()> number = make_big_integer<float_words<T>()>(exponent < 0 ? fraction >> -exponent : fraction,
+        exponent < 0 ? 0 : exponent);
+    int size = 0;
+    for (big_integer<float_words<T>()> zero{}; size == 0 || compare(number, zero) != 0;)
+        text[size++] = static_cast<char>('0' + divide(number, 10));
+    for (int i = 0; i < size / 2; ++i) {
+        const char digit = text[i];
+        text[i] = text[size - 1 - i];
+        text[size - 1 - i] = digit;
+    }
+    return size;
+}
+
+template<size_t Capacity> struct float_chars {
+    char text[Capacity];
+    size_t size;
+};
+
+// the same text as std::to_chars with the shortest representation
+template<typename T>
+constexpr float_chars<float_capacity<T>()> format_float(T value, float_format format) {
+    float_chars<float_capacity<T>()> result{};
+    const float_decimal number = shortest_decimal(value);
+    if (number.negative)
+        result.text[result.size++] = '-';
+    if (number.nan || number.infinity) {
+        const char* text = number.nan ? "nan" : "inf";
+        for (size_t i = 0; i < 3; ++i)
+            result.text[result.size++] = text[i];
+        return result;
+    }
+    char integer[float_capacity<T>()] = {};
+    const int integer_size = number.exponent > number.count ? write_integer(value < 0 ? -value : value, integer) : 0;
+    const int count = number.count, exponent = number.exponent - 1;
+    const int fixed_size = number.exponent <= 0 ? 2 - number.exponent + count :
+        number.exponent > count ? integer_size : number.exponent == count ? count : count + 1;
+    const int magnitude = exponent < 0 ? -exponent : exponent;
+    const int exponent_size = magnitude >= 1000 ? 4 : magnitude >= 100 ? 3 : 2;
+    const int scientific_size = count + (count > 1 ? 1 : 0) + 2 + exponent_size;
+    if (format == float_format::fixed || (format == float_format::general && fixed_size <= scientific_size)) {
+        if (number.exponent <= 0) {
+            result.text[result.size++] = '0';
+            result.text[result.size++] = '.';
+            for (int i = number.exponent; i < 0; ++i)
+                result.text[result.size++] = '0';
+        }
+        for (int i = 0; i < integer_size; ++i)
+            result.text[result.size++] = integer[i];
+        if (integer_size > 0)
+            return result;
+        for (int i = 0; i < count; ++i) {
+            if (i == number.exponent && i > 0)
+                result.text[result.size++] = '.';
+            result.text[result.size++] = number.digits[i];
+        }
+        return result;
+    }
+    result.text[result.size++] = number.digits[0];
+    if (count > 1)
+        result.text[result.size++] = '.';
+    for (int i = 1; i < count; ++i)
+        result.text[result.size++] = number.digits[i];
+    result.text[result.size++] = 'e';
+    result.text[result.size++] = exponent < 0 ? '-' : '+';
+    for (int power = exponent_size == 4 ? 1000 : exponent_size == 3 ? 100 : 10; power > 0; power /= 10)
+        result.text[result.size++] = static_cast<char>('0' + magnitude / power % 10);
+    return result;
+}
+
+template<typename Char, size_t Capacity, size_t ... Indexes>
+constexpr basic_static_string<Char, sizeof ... (Indexes) + 1> make_float_string(const float_chars<Capacity>& chars, index_sequence<Indexes ...>) {
+    return {static_cast<Char>(chars.text[Indexes]) ..., static_cast<Char>('\0')};
+}
+
+} // namespace __static_string_detail
+
+template<typename T>
+constexpr size_t float_to_static_string_length(T value, float_format format = float_format::general) {
+    return __static_string_detail::format_float(value, format).size;
+}
+
+template<size_t Length, typename T, typename Char>
+constexpr basic_static_string<Char, Length + 1> float_to_static_string(T value, float_format format = float_format::general) {
+    return float_to_static_string_length(value, format) != Length ?
+        throw std::invalid_argument("length does not match value") :
+        __static_string_detail::make_float_string<Char>(__static_string_detail::format_float(value, format),
+            __static_string_detail::make_index_sequence<Length>{});
+}
+
+template<typename Char, size_t Size>
+constexpr long long static_string_to_int(const basic_static_string<Char, Size>& str) {
+    return __static_string_detail::to_int(str);
+}
+
+template<typename Char, size_t Size>
+constexpr long long static_string_to_int(const Char (& str)[Size]) {
+    return static_string_to_int(__static_string_detail::make(str));
 }
 
 template<typename Char, size_t Size>
@@ -515,6 +1810,4133 @@ constexpr unsigned long long static_string_to_uint(const Char (& str)[Size]) {
     return static_string_to_uint(__static_string_detail::make(str));
 }
 
+namespace __static_string_detail {
+
+#ifdef SNW1_STATIC_STRING_HAS_SWAR
+inline bool is_eight_digits(unsigned long long chunk) {
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+        0x3333333333333333ULL;
+}
+
+// pairs, then quads, then the two halves of the eight digits, most significant digit first in memory
+inline unsigned long long eight_digits(unsigned long long chunk) {
+    chunk -= 0x3030303030303030ULL;
+    chunk = chunk * 10 + (chunk >> 8);
+    return (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+        (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+}
+#endif
+
+#ifdef SNW1_STATIC_STRING_HAS_SSE2
+inline bool sixteen_digits(const char* str, unsigned long long& value) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+    const __m128i invalid = _mm_or_si128(_mm_cmplt_epi8(chunk, _mm_set1_epi8('0')), _mm_cmpgt_epi8(chunk, _mm_set1_epi8('9')));
+    if (_mm_movemask_epi8(invalid) != 0)
+        return false;
+    const __m128i digits = _mm_sub_epi8(chunk, _mm_set1_epi8('0'));
+    const __m128i pairs = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(digits, _mm_set1_epi16(0x00FF)), _mm_set1_epi16(10)),
+        _mm_srli_epi16(digits, 8));
+    const __m128i quads = _mm_madd_epi16(pairs, _mm_set_epi16(1, 100, 1, 100, 1, 100, 1, 100));
+    const __m128i halves = _mm_madd_epi16(_mm_packs_epi32(quads, quads), _mm_set_epi16(1, 10000, 1, 10000, 1, 10000, 1, 10000));
+    value = static_cast<unsigned long long>(_mm_cvtsi128_si32(halves)) * 100000000ULL +
+        static_cast<unsigned long long>(_mm_cvtsi128_si32(_mm_srli_si128(halves, 4)));
+    return true;
+}
+#endif
+
+template<typename T, typename Char>
+parse_result<T> parse_runtime(const Char* str, size_t length, int radix, std::false_type) {
+    return parse_integer<T>(str, length, radix);
+}
+
+// decimal digits are consumed 16 (SSE2) and 8 (SWAR) at a time while the value can not overflow,
+// the rest goes through the checked scalar loop
+template<typename T>
+parse_result<T> parse_runtime(const char* str, size_t length, int radix, std::false_type) {
+    if (radix != 10)
+        return parse_integer<T>(str, length, radix);
+    bool negative = false;
+    unsigned base = 10;
+    const size_t first = parse_prefix(str, length, base, negative);
+    size_t position = first;
+    unsigned long long value = 0;
+    while (position < length && str[position] == '0')
+        ++position;
+#ifdef SNW1_STATIC_STRING_HAS_SWAR
+    // up to 19 significant digits fit in unsigned long long whatever they are
+    const size_t significant = position;
+#endif
+#ifdef SNW1_STATIC_STRING_HAS_SSE2
+    if (length - position >= 16 && sixteen_digits(str + position, value))
+        position += 16;
+#endif
+#ifdef SNW1_STATIC_STRING_HAS_SWAR
+    for (; length - position >= 8 && position - significant + 8 <= 19 &&
+        is_eight_digits(load_eight(str + position)); position += 8)
+        value = value * 100000000ULL + eight_digits(load_eight(str + position));
+#endif
+    return parse_digits<T>(str, length, first, position, base, negative, value);
+}
+
+template<typename T>
+constexpr int exact_power10() {
+    return std::numeric_limits<T>::digits >= 64 ? 27 : std::numeric_limits<T>::digits >= 53 ? 22 :
+        std::numeric_limits<T>::digits >= 24 ? 10 : 0;
+}
+
+#ifdef __SIZEOF_INT128__
+inline unsigned long long multiply_wide(unsigned long long a, unsigned long long b, unsigned long long& high) {
+    const uint128 product = static_cast<uint128>(a) * b;
+    high = static_cast<unsigned long long>(product >> 64);
+    return static_cast<unsigned long long>(product);
+}
+#else
+inline unsigned long long multiply_wide(unsigned long long a, unsigned long long b, unsigned long long& high) {
+    const unsigned long long ha = a >> 32, hb = b >> 32, la = a & 0xffffffffULL, lb = b & 0xffffffffULL;
+    const unsigned long long hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+    const unsigned long long middle = (ll >> 32) + (hl & 0xffffffffULL) + (lh & 0xffffffffULL);
+    high = hh + (hl >> 32) + (lh >> 32) + (middle >> 32);
+    return (middle << 32) | (ll & 0xffffffffULL);
+}
+#endif
+
+// 64 bits of number from the bit at position up, zeros below bit 0
+template<size_t Words>
+constexpr unsigned long long extract(const big_integer<Words>& number, long position) {
+    unsigned long long result = 0;
+    for (long bit = position + 63; bit >= position; --bit)
+        result = result << 1 | (bit >= 0 && static_cast<size_t>(bit / 32) < number.size ? number.words[bit / 32] >> (bit % 32) & 1 : 0);
+    return result;
+}
+
+// 5^q as (high * 2^64 + low) * 2^exponent rounded down, with the top bit of high set,
+// for every q the 19 digit mantissa of a double can meet
+struct power5_table {
+    static constexpr int min = std::numeric_limits<double>::min_exponent10 - std::numeric_limits<double>::digits10 - 21;
+    static constexpr int max = std::numeric_limits<double>::max_exponent10 + 1;
+
+    unsigned long long high[max - min + 1];
+    unsigned long long low[max - min + 1];
+    int exponent[max - min + 1];
+
+    power5_table() : high(), low(), exponent() {
+        big_integer<32> power = make_big_integer<32>(1, 0);
+        for (int q = 0; q <= max; ++q, multiply(power, 5))
+            store(q, power, 0);
+        // floor(floor(x / 5) / 5) == floor(x / 25), so dividing 2^960 repeatedly gives every floor(2^960 / 5^-q)
+        big_integer<32> inverse = make_big_integer<32>(1, 960);
+        for (int q = -1; q >= min; --q) {
+            divide(inverse, 5);
+            store(q, inverse, -960);
+        }
+    }
+
+    void store(int q, const big_integer<32>& power, int shift) {
+        const long length = static_cast<long>(bit_length(power));
+        high[q - min] = extract(power, length - 64);
+        low[q - min] = extract(power, length - 128);
+        exponent[q - min] = static_cast<int>(length - 128) + shift;
+    }
+};
+
+// rounds the 192-bit number to a fraction of Digits bits, half to even, and its binary exponent
+template<int Digits>
+inline unsigned long long round_wide(unsigned long long high, unsigned long long middle, unsigned long long low, int& exponent) {
+    exponent = 192;
+    for (; high == 0; exponent -= 64) {
+        high = middle;
+        middle = low;
+        low = 0;
+    }
+    const int zeros = __builtin_clzll(high);
+    if (zeros > 0) {
+        high = high << zeros | middle >> (64 - zeros);
+        middle = middle << zeros | low >> (64 - zeros);
+        low <<= zeros;
+    }
+    exponent -= zeros + Digits;
+    unsigned long long fraction = high >> (64 - Digits);
+    const bool round = (high >> (63 - Digits) & 1) != 0;
+    const bool sticky = (high & ((1ULL << (63 - Digits)) - 1)) != 0 || middle != 0 || low != 0;
+    if (round && (sticky || fraction % 2 == 1) && ++fraction == 1ULL << Digits) {
+        fraction >>= 1;
+        ++exponent;
+    }
+    return fraction;
+}
+
+// Eisel-Lemire: mantissa * 10^exponent lies in [P, P + mantissa) * 2^k for P the product of the mantissa
+// and the rounded down 128-bit power of five, the result is certain when both ends round alike
+template<typename T>
+bool decimal_to_floating_fast(unsigned long long mantissa, long exponent, T& result) {
+    constexpr int Digits = std::numeric_limits<T>::digits;
+    static const power5_table table;
+    if (Digits > 53 || exponent < power5_table::min || exponent > power5_table::max)
+        return false;
+    const size_t index = static_cast<size_t>(exponent - power5_table::min);
+    unsigned long long low_high = 0, high_high = 0;
+    const unsigned long long low = multiply_wide(mantissa, table.low[index], low_high);
+    const unsigned long long high_low = multiply_wide(mantissa, table.high[index], high_high);
+    const unsigned long long middle = high_low + low_high;
+    const unsigned long long high = high_high + (middle < high_low ? 1 : 0);
+    const unsigned long long upper_low = low + mantissa;
+    const unsigned long long upper_middle = middle + (upper_low < low ? 1 : 0);
+    const unsigned long long upper_high = high + (upper_middle < middle ? 1 : 0);
+    int binary = 0, upper_binary = 0;
+    const unsigned long long fraction = round_wide<(Digits < 53 ? Digits : 53)>(high, middle, low, binary);
+    if (fraction != round_wide<(Digits < 53 ? Digits : 53)>(upper_high, upper_middle, upper_low, upper_binary) || binary != upper_binary)
+        return false;
+    binary += table.exponent[index] + static_cast<int>(exponent);
+    if (binary < float_min_exponent<T>() || binary > std::numeric_limits<T>::max_exponent - Digits)
+        return false;
+    result = compose<T>(fraction, binary);
+    return true;
+}
+
+// exact when the digits fit in the mantissa and the power of ten is exact, then Eisel-Lemire,
+// otherwise the correctly rounded constexpr conversion
+template<typename T, typename Char>
+parse_result<T> parse_runtime(const Char* str, size_t length, int radix, std::true_type) {
+    const decimal_number number = scan_decimal(str, length);
+    if (radix != 10 || number.error != parse_error::none || number.nan || number.infinity || number.mantissa == 0)
+        return parse_number<T>(str, length, radix, std::true_type{});
+    static const T powers[] = {1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L, 1e10L, 1e11L, 1e12L, 1e13L,
+        1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L};
+    const unsigned long long exact_mantissa = std::numeric_limits<T>::digits >= 64 ? std::numeric_limits<unsigned long long>::max() :
+        1ULL << (std::numeric_limits<T>::digits % 64);
+    if (!number.truncated && number.mantissa <= exact_mantissa &&
+        number.exponent >= -exact_power10<T>() && number.exponent <= exact_power10<T>()) {
+        const T value = number.exponent < 0 ? static_cast<T>(number.mantissa) / powers[-number.exponent] :
+            static_cast<T>(number.mantissa) * powers[number.exponent];
+        return {number.negative ? -value : value, parse_error::none, length};
+    }
+    T value = T();
+    if (!number.truncated && decimal_to_floating_fast(number.mantissa, number.exponent, value))
+        return {number.negative ? -value : value, parse_error::none, length};
+    return decimal_to_floating<T>(str, number);
+}
+
+template<typename T, typename Char>
+parse_result<T> parse_runtime(const Char* str, size_t length, int radix) {
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "T must be an integer or a floating point type");
+    return parse_runtime<T>(str, length, radix, std::is_floating_point<T>{});
+}
+
+} // namespace __static_string_detail
+
+template<typename T, typename Char, size_t Size>
+constexpr parse_result<T> parse(const basic_static_string<Char, Size>& str, int radix = 10) {
+    return __static_string_detail::parse_number<T>(&str.data[0], Size - 1, radix);
+}
+
+template<typename T, typename Char, size_t Size>
+constexpr parse_result<T> parse(const Char (& str)[Size], int radix = 10) {
+    return __static_string_detail::parse_number<T>(str, Size - 1, radix);
+}
+
+template<typename T, typename Char>
+parse_result<T> parse(const Char* first, const Char* last, int radix = 10) {
+    return __static_string_detail::parse_runtime<T>(first, static_cast<size_t>(last - first), radix);
+}
+
+template<typename T, typename Char, typename Traits, typename Alloc>
+parse_result<T> parse(const std::basic_string<Char, Traits, Alloc>& str, int radix = 10) {
+    return __static_string_detail::parse_runtime<T>(str.data(), str.size(), radix);
+}
+
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+template<typename T, typename Char, typename Traits>
+parse_result<T> parse(std::basic_string_view<Char, Traits> str, int radix = 10) {
+    return __static_string_detail::parse_runtime<T>(str.data(), str.size(), radix);
+}
+#endif
+
+template<typename Char, size_t Size>
+constexpr unsigned long long static_string_hash(const basic_static_string<Char, Size>& str) {
+    return str.hash();
+}
+
+template<typename Char, size_t Size>
+constexpr unsigned long long static_string_hash(const Char (& str)[Size]) {
+    return static_string_hash(__static_string_detail::make(str));
+}
+
+namespace __static_string_detail {
+
+// same polynomial as hash(), evaluated eight characters per step so that
+// the multiplications of a block do not depend on each other, fold maps each
+// character before hashing (ascii_fold gives ihash())
+template<typename Char, typename Fold = identity_fold>
+inline unsigned long long hash_unrolled(const Char* str, size_t length, Fold fold = Fold{}) {
+    constexpr unsigned long long p1 = 33ULL, p2 = p1 * 33ULL, p3 = p2 * 33ULL, p4 = p3 * 33ULL,
+        p5 = p4 * 33ULL, p6 = p5 * 33ULL, p7 = p6 * 33ULL, p8 = p7 * 33ULL;
+    unsigned long long result = 5381ULL;
+    size_t i = length;
+    for (; i % 8 != 0; --i)
+        result = result * 33ULL + static_cast<unsigned long long>(fold(str[i - 1]) + 1);
+    for (; i > 0; i -= 8) {
+        const Char* block = str + i - 8;
+        result = result * p8 +
+            ((static_cast<unsigned long long>(fold(block[0]) + 1) + static_cast<unsigned long long>(fold(block[1]) + 1) * p1) +
+            (static_cast<unsigned long long>(fold(block[2]) + 1) * p2 + static_cast<unsigned long long>(fold(block[3]) + 1) * p3)) +
+            ((static_cast<unsigned long long>(fold(block[4]) + 1) * p4 + static_cast<unsigned long long>(fold(block[5]) + 1) * p5) +
+            (static_cast<unsigned long long>(fold(block[6]) + 1) * p6 + static_cast<unsigned long long>(fold(block[7]) + 1) * p7));
+    }
+    return result;
+}
+
+} // namespace __static_string_detail
+
+template<typename Char>
+inline unsigned long long static_string_hash(const Char* str, size_t length) {
+    return __static_string_detail::hash_unrolled(str, length);
+}
+
+template<typename Char>
+inline void static_string_hash(const Char* const* strs, const size_t* lengths, size_t count, unsigned long long* hashes) {
+    for (size_t i = 0; i < count; ++i)
+        hashes[i] = __static_string_detail::hash_unrolled(strs[i], lengths[i]);
+}
+
+template<typename Algo, typename Char>
+inline unsigned long long static_string_hash(const Char* str, size_t length,
+    unsigned long long key0 = 0, unsigned long long key1 = 0) {
+    return __static_string_detail::hash(Algo{}, __static_string_detail::runtime_reader<Char>{str},
+        length * sizeof(Char), key0, key1);
+}
+
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+template<typename Char>
+inline unsigned long long static_string_hash(std::basic_string_view<Char> str) {
+    return __static_string_detail::hash_unrolled(str.data(), str.size());
+}
+
+template<typename Char>
+inline void static_string_hash(const std::basic_string_view<Char>* strs, size_t count, unsigned long long* hashes) {
+    for (size_t i = 0; i < count; ++i)
+        hashes[i] = __static_string_detail::hash_unrolled(strs[i].data(), strs[i].size());
+}
+
+template<typename Algo, typename Char>
+inline unsigned long long static_string_hash(std::basic_string_view<Char> str,
+    unsigned long long key0 = 0, unsigned long long key1 = 0) {
+    return static_string_hash<Algo>(str.data(), str.size(), key0, key1);
+}
+#endif
+
+template<typename Char, size_t Size>
+constexpr unsigned long long static_string_ihash(const basic_static_string<Char, Size>& str) {
+    return str.ihash();
+}
+
+template<typename Char, size_t Size>
+constexpr unsigned long long static_string_ihash(const Char (& str)[Size]) {
+    return __static_string_detail::ihash(str, Size - 1);
+}
+
+template<typename Char>
+inline unsigned long long static_string_ihash(const Char* str, size_t length) {
+    return __static_string_detail::hash_unrolled(str, length, __static_string_detail::ascii_fold{});
+}
+
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+template<typename Char>
+inline unsigned long long static_string_ihash(std::basic_string_view<Char> str) {
+    return static_string_ihash(str.data(), str.size());
+}
+#endif
+
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+namespace __static_string_detail {
+
+template<typename Str>
+struct static_string_traits;
+
+template<typename Char, size_t Size>
+struct static_string_traits<basic_static_string<Char, Size>> {
+    using char_type = Char;
+    static constexpr size_t size = Size;
+};
+
+template<typename Provider, size_t ... Indexes>
+constexpr const auto& intern(Provider provider, index_sequence<Indexes ...>) {
+    constexpr auto str = provider();
+    return static_string_storage<typename static_string_traits<decltype(provider())>::char_type, str.data[Indexes] ...>::value;
+}
+
+} // namespace __static_string_detail
+
+template<typename Provider>
+constexpr const auto& static_string_intern(Provider provider) {
+#ifdef SNW1_STATIC_STRING_HAS_CLASS_NTTP
+    return __static_string_detail::object<provider()>();
+#else
+    return __static_string_detail::intern(provider,
+        __static_string_detail::make_index_sequence<__static_string_detail::static_string_traits<decltype(provider())>::size - 1>{});
+#endif
+}
+#endif
+
+namespace __static_string_detail {
+
+constexpr unsigned long long mix(unsigned long long hash, unsigned long long seed) {
+    hash ^= seed * 0x9e3779b97f4a7c15ULL;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+template<typename Char>
+constexpr bool equal(const Char* str1, const Char* str2, size_t length) {
+    for (size_t i = 0; i < length; ++i)
+        if (str1[i] != str2[i])
+            return false;
+    return true;
+}
+
+inline bool equal_bytes(const void* ptr1, const void* ptr2, size_t size) {
+    const unsigned char* bytes1 = static_cast<const unsigned char*>(ptr1);
+    const unsigned char* bytes2 = static_cast<const unsigned char*>(ptr2);
+    for (; size >= 8; bytes1 += 8, bytes2 += 8, size -= 8) {
+        std::uint64_t word1 = 0, word2 = 0;
+        std::memcpy(&word1, bytes1, 8);
+        std::memcpy(&word2, bytes2, 8);
+        if (word1 != word2)
+            return false;
+    }
+    if (size >= 4) {
+        std::uint32_t word1 = 0, word2 = 0;
+        std::memcpy(&word1, bytes1, 4);
+        std::memcpy(&word2, bytes2, 4);
+        if (word1 != word2)
+            return false;
+        bytes1 += 4, bytes2 += 4, size -= 4;
+    }
+    for (; size > 0; ++bytes1, ++bytes2, --size)
+        if (*bytes1 != *bytes2)
+            return false;
+    return true;
+}
+
+constexpr size_t max(std::initializer_list<size_t> values) {
+    size_t result = 0;
+    for (size_t value : values)
+        if (value > result)
+            result = value;
+    return result;
+}
+
+constexpr size_t sum(std::initializer_list<size_t> values) {
+    size_t result = 0;
+    for (size_t value : values)
+        result += value;
+    return result;
+}
+
+template<typename Value>
+struct static_string_map_entry {
+    size_t offset;
+    size_t length;
+    Value value;
+};
+
+// value_reader over the lower case characters
+template<typename Char>
+struct lower_reader {
+    constexpr unsigned long long byte(size_t index) const {
+        return static_cast<unsigned long long>(static_cast<typename std::make_unsigned<Char>::type>(
+            lower(str[index / sizeof(Char)]))) >> (8 * (index % sizeof(Char))) & 0xffULL;
+    }
+    constexpr unsigned long long read32(size_t index) const {
+        return byte(index) | byte(index + 1) << 8 | byte(index + 2) << 16 | byte(index + 3) << 24;
+    }
+    constexpr unsigned long long read64(size_t index) const {
+        return read32(index) | read32(index + 4) << 32;
+    }
+    const Char* str;
+};
+
+template<typename Char>
+struct runtime_lower_reader_selector {
+    using type = lower_reader<Char>;
+};
+
+#ifdef SNW1_STATIC_STRING_HAS_SWAR
+// memory_reader folding eight characters at a time, zero bytes of a partial word are not letters
+struct folding_reader {
+    unsigned long long byte(size_t index) const {
+        return static_cast<unsigned char>(fold(str[index]));
+    }
+    unsigned long long read32(size_t index) const {
+        std::uint32_t result = 0;
+        std::memcpy(&result, str + index, sizeof(result));
+        return fold_eight(result);
+    }
+    unsigned long long read64(size_t index) const {
+        return fold_eight(load_eight(str + index));
+    }
+    const char* str;
+};
+
+template<>
+struct runtime_lower_reader_selector<char> {
+    using type = folding_reader;
+};
+#endif
+
+template<typename Char> using runtime_lower_reader = typename runtime_lower_reader_selector<Char>::type;
+
+// map keys are hashed with the seeded wyhash, the builder picks a seed for which all key hashes differ
+template<typename Char>
+constexpr unsigned long long key_hash(const Char* key, size_t length, unsigned long long seed) {
+    return hash(wyhash{}, value_reader<Char>{key}, length * sizeof(Char), seed, 0);
+}
+
+template<typename Char>
+constexpr unsigned long long key_ihash(const Char* key, size_t length, unsigned long long seed) {
+    return hash(wyhash{}, lower_reader<Char>{key}, length * sizeof(Char), seed, 0);
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, typename Value, size_t Count, size_t Length> struct basic_static_string_map {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    static constexpr size_t bucket_count = Count / 2 + 1;
+    constexpr size_t size() const {
+        return Count;
+    }
+    constexpr bool empty() const {
+        return Count == 0;
+    }
+    constexpr unsigned long long hash(const Char* key, size_t length) const {
+        return __static_string_detail::key_hash(key, length, seed);
+    }
+    constexpr unsigned long long ihash(const Char* key, size_t length) const {
+        return __static_string_detail::key_ihash(key, length, seed);
+    }
+    constexpr size_t slot(unsigned long long hash) const {
+        return __static_string_detail::mix(hash, displacements[__static_string_detail::mix(hash, 0) % bucket_count]) % Count;
+    }
+    // hash is hash(key, length)
+    constexpr size_t index(const Char* key, size_t length, unsigned long long hash) const {
+        return Count != 0 && entries[slot(hash)].length == length &&
+            __static_string_detail::equal(keys + entries[slot(hash)].offset, key, length) ? slot(hash) : npos;
+    }
+    template<size_t Size> constexpr size_t index(const basic_static_string<Char, Size>& key) const {
+        return index(&key.data[0], Size - 1, hash(&key.data[0], Size - 1));
+    }
+    template<size_t Size> constexpr size_t index(const Char (& key)[Size]) const {
+        return index(key, Size - 1, hash(key, Size - 1));
+    }
+    size_t index(const Char* key, size_t length) const {
+        if (Count == 0)
+            return npos;
+        const size_t found = slot(__static_string_detail::hash(wyhash{},
+            __static_string_detail::runtime_reader<Char>{key}, length * sizeof(Char), seed, 0));
+        return entries[found].length == length &&
+            std::char_traits<Char>::compare(keys + entries[found].offset, key, length) == 0 ? found : npos;
+    }
+    // case-insensitive lookup, the keys must be lower case as make_static_string_imap() stores them,
+    // hash is ihash(key, length)
+    constexpr size_t iindex(const Char* key, size_t length, unsigned long long hash) const {
+        return Count != 0 && entries[slot(hash)].length == length &&
+            __static_string_detail::iequal(keys + entries[slot(hash)].offset, length, key, length) ? slot(hash) : npos;
+    }
+    template<size_t Size> constexpr size_t iindex(const basic_static_string<Char, Size>& key) const {
+        return iindex(&key.data[0], Size - 1, ihash(&key.data[0], Size - 1));
+    }
+    template<size_t Size> constexpr size_t iindex(const Char (& key)[Size]) const {
+        return iindex(key, Size - 1, ihash(key, Size - 1));
+    }
+    size_t iindex(const Char* key, size_t length) const {
+        if (Count == 0)
+            return npos;
+        const size_t found = slot(__static_string_detail::hash(wyhash{},
+            __static_string_detail::runtime_lower_reader<Char>{key}, length * sizeof(Char), seed, 0));
+        return entries[found].length == length &&
+            __static_string_detail::iequal_runtime(keys + entries[found].offset, key, length) ? found : npos;
+    }
+    template<size_t Size> constexpr bool contains(const basic_static_string<Char, Size>& key) const {
+        return index(key) != npos;
+    }
+    template<size_t Size> constexpr bool contains(const Char (& key)[Size]) const {
+        return index(key) != npos;
+    }
+    bool contains(const Char* key, size_t length) const {
+        return index(key, length) != npos;
+    }
+    template<size_t Size> constexpr const Value& at(const basic_static_string<Char, Size>& key) const {
+        return index(key) != npos ? entries[index(key)].value : throw std::out_of_range("static_string_map: key not found");
+    }
+    template<size_t Size> constexpr const Value& at(const Char (& key)[Size]) const {
+        return at(__static_string_detail::make(key));
+    }
+    const Value* find(const Char* key, size_t length) const {
+        const size_t slot = index(key, length);
+        return slot != npos ? &entries[slot].value : nullptr;
+    }
+    template<size_t Size> constexpr bool icontains(const basic_static_string<Char, Size>& key) const {
+        return iindex(key) != npos;
+    }
+    template<size_t Size> constexpr bool icontains(const Char (& key)[Size]) const {
+        return iindex(key) != npos;
+    }
+    bool icontains(const Char* key, size_t length) const {
+        return iindex(key, length) != npos;
+    }
+    const Value* ifind(const Char* key, size_t length) const {
+        const size_t slot = iindex(key, length);
+        return slot != npos ? &entries[slot].value : nullptr;
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    size_t index(std::basic_string_view<Char> key) const {
+        return index(key.data(), key.size());
+    }
+    bool contains(std::basic_string_view<Char> key) const {
+        return index(key.data(), key.size()) != npos;
+    }
+    const Value* find(std::basic_string_view<Char> key) const {
+        return find(key.data(), key.size());
+    }
+    size_t iindex(std::basic_string_view<Char> key) const {
+        return iindex(key.data(), key.size());
+    }
+    bool icontains(std::basic_string_view<Char> key) const {
+        return iindex(key.data(), key.size()) != npos;
+    }
+    const Value* ifind(std::basic_string_view<Char> key) const {
+        return ifind(key.data(), key.size());
+    }
+#endif
+    Char keys[Length + 1];
+    __static_string_detail::static_string_map_entry<Value> entries[Count > 0 ? Count : 1];
+    unsigned long long displacements[bucket_count];
+    unsigned long long seed;
+};
+
+template<typename Value, size_t Count, size_t Length>
+using static_string_map = basic_static_string_map<char, Value, Count, Length>;
+template<typename Value, size_t Count, size_t Length>
+using static_wstring_map = basic_static_string_map<wchar_t, Value, Count, Length>;
+
+namespace __static_string_detail {
+
+template<typename Char, typename Value, size_t Count, size_t Length, size_t Size>
+constexpr int add(basic_static_string_map<Char, Value, Count, Length>& map,
+    static_string_map_entry<Value> (& entries)[Count > 0 ? Count : 1], size_t& count, size_t& offset,
+    const std::pair<basic_static_string<Char, Size>, Value>& item) {
+    for (size_t i = 0; i < Size - 1; ++i)
+        map.keys[offset + i] = item.first.data[i];
+    entries[count] = {offset, Size - 1, item.second};
+    offset += Size - 1;
+    ++count;
+    return 0;
+}
+
+// CHD: group the keys by bucket, then place the largest buckets first, searching
+// for a displacement that maps all keys of a bucket to free slots; false if two keys
+// share a hash or no displacement is found, the caller then retries with another seed
+template<typename Char, typename Value, size_t Count, size_t Length>
+constexpr bool displace(basic_static_string_map<Char, Value, Count, Length>& map,
+    const static_string_map_entry<Value> (& entries)[Count > 0 ? Count : 1],
+    const unsigned long long (& hashes)[Count > 0 ? Count : 1]) {
+    constexpr size_t bucket_count = basic_static_string_map<Char, Value, Count, Length>::bucket_count;
+    constexpr size_t capacity = Count > 0 ? Count : 1;
+    size_t bucket_begin[bucket_count + 1]{};
+    size_t order[capacity]{};
+    size_t max_bucket_size = 0;
+    for (size_t i = 0; i < Count; ++i)
+        ++bucket_begin[mix(hashes[i], 0) % bucket_count + 1];
+    for (size_t bucket = 0; bucket < bucket_count; ++bucket) {
+        if (bucket_begin[bucket + 1] > max_bucket_size)
+            max_bucket_size = bucket_begin[bucket + 1];
+        bucket_begin[bucket + 1] += bucket_begin[bucket];
+    }
+    size_t bucket_end[bucket_count]{};
+    for (size_t bucket = 0; bucket < bucket_count; ++bucket)
+        bucket_end[bucket] = bucket_begin[bucket];
+    for (size_t i = 0; i < Count; ++i)
+        order[bucket_end[mix(hashes[i], 0) % bucket_count]++] = i;
+    for (size_t bucket = 0; bucket < bucket_count; ++bucket)
+        for (size_t i = bucket_begin[bucket]; i < bucket_end[bucket]; ++i)
+            for (size_t j = i + 1; j < bucket_end[bucket]; ++j)
+                if (hashes[order[i]] == hashes[order[j]]) {
+                    if (entries[order[i]].length == entries[order[j]].length &&
+                        equal(map.keys + entries[order[i]].offset, map.keys + entries[order[j]].offset, entries[order[i]].length))
+                        throw std::invalid_argument("static_string_map: duplicate key");
+                    return false;
+                }
+    bool occupied[capacity]{};
+    size_t slots[capacity]{};
+    for (size_t bucket = 0; bucket < bucket_count; ++bucket)
+        map.displacements[bucket] = 0;
+    for (size_t bucket_size = max_bucket_size; bucket_size > 0; --bucket_size) {
+        for (size_t bucket = 0; bucket < bucket_count; ++bucket) {
+            if (bucket_end[bucket] - bucket_begin[bucket] != bucket_size)
+                continue;
+            for (unsigned long long displacement = 1; ; ++displacement) {
+                if (displacement > 16ULL * Count + 1024ULL)
+                    return false;
+                size_t placed = 0;
+                for (; placed < bucket_size; ++placed) {
+                    const size_t slot = mix(hashes[order[bucket_begin[bucket] + placed]], displacement) % Count;
+                    bool free = !occupied[slot];
+                    for (size_t j = 0; j < placed && free; ++j)
+                        free = slots[j] != slot;
+                    if (!free)
+                        break;
+                    slots[placed] = slot;
+                }
+                if (placed < bucket_size)
+                    continue;
+                for (size_t i = 0; i < bucket_size; ++i) {
+                    occupied[slots[i]] = true;
+                    map.entries[slots[i]] = entries[order[bucket_begin[bucket] + i]];
+                }
+                map.displacements[bucket] = displacement;
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename Char, typename Value, size_t Count, size_t Length, typename ... Items>
+constexpr basic_static_string_map<Char, Value, Count, Length> make_static_string_map(const Items& ... items) {
+    constexpr size_t capacity = Count > 0 ? Count : 1;
+    basic_static_string_map<Char, Value, Count, Length> map{};
+    static_string_map_entry<Value> entries[capacity]{};
+    unsigned long long hashes[capacity]{};
+    size_t count = 0, offset = 0;
+    int unused[] = {0, add(map, entries, count, offset, items) ...};
+    static_cast<void>(unused);
+    // make_static_string_imap() stores lowered keys, so their plain hash is the ihash() of any case
+    for (unsigned long long seed = 0; seed < 64; ++seed) {
+        for (size_t i = 0; i < Count; ++i)
+            hashes[i] = key_hash(map.keys + entries[i].offset, entries[i].length, seed);
+        if (displace(map, entries, hashes)) {
+            map.seed = seed;
+            return map;
+        }
+    }
+    throw std::logic_error("static_string_map: perfect hash not found");
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, typename Value, size_t ... Sizes>
+constexpr auto make_static_string_map(const std::pair<basic_static_string<Char, Sizes>, Value>& ... items) {
+    return __static_string_detail::make_static_string_map<Char, Value, sizeof ... (Sizes),
+        __static_string_detail::sum({(Sizes - 1) ...})>(items ...);
+}
+
+// keys are lowered at compile time so that iindex(), icontains() and ifind() match any case,
+// keys equal up to case are reported as duplicates
+template<typename Char, typename Value, size_t ... Sizes>
+constexpr auto make_static_string_imap(const std::pair<basic_static_string<Char, Sizes>, Value>& ... items) {
+    return __static_string_detail::make_static_string_map<Char, Value, sizeof ... (Sizes),
+        __static_string_detail::sum({(Sizes - 1) ...})>(std::make_pair(items.first.lower(), items.second) ...);
+}
+
+namespace __static_string_detail {
+
+template<typename Char>
+struct static_string_switch_entry {
+    size_t offset;
+    size_t length;
+    size_t index;
+    Char pivot;
+};
+
+template<typename Result, size_t Index, typename Handlers, typename ... Args>
+Result call_handler(Handlers& handlers, const Args& ... args) {
+    return std::get<Index>(handlers)(args ...);
+}
+
+template<typename Result, typename Handlers, size_t ... Indexes, typename ... Args>
+Result dispatch(Handlers& handlers, size_t index, index_sequence<Indexes ...>, const Args& ... args) {
+    using handler = Result (*)(Handlers&, const Args& ...);
+    static constexpr handler table[] = {call_handler<Result, Indexes, Handlers, Args ...> ...};
+    return table[index](handlers, args ...);
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Count, size_t Length, size_t MaxLength> struct basic_static_string_switch {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    constexpr size_t size() const {
+        return Count;
+    }
+    template<size_t Size> constexpr size_t index(const basic_static_string<Char, Size>& label) const {
+        if (Size - 1 > MaxLength)
+            return npos;
+        for (size_t i = group_begin[Size - 1]; i < group_begin[Size]; ++i)
+            if (__static_string_detail::equal(keys + entries[i].offset, &label.data[0], Size - 1))
+                return entries[i].index;
+        return npos;
+    }
+    template<size_t Size> constexpr size_t index(const Char (& label)[Size]) const {
+        return index(__static_string_detail::make(label));
+    }
+    size_t index(const Char* str, size_t length) const {
+        if (length > MaxLength)
+            return npos;
+        const size_t begin = group_begin[length], end = group_begin[length + 1];
+        const size_t pivot = pivots[length];
+        if (pivot != npos) {
+            const Char ch = str[pivot];
+            for (size_t i = begin; i < end; ++i)
+                if (entries[i].pivot == ch)
+                    return __static_string_detail::equal_bytes(keys + entries[i].offset, str, length * sizeof(Char)) ?
+                        entries[i].index : npos;
+            return npos;
+        }
+        for (size_t i = begin; i < end; ++i)
+            if (__static_string_detail::equal_bytes(keys + entries[i].offset, str, length * sizeof(Char)))
+                return entries[i].index;
+        return npos;
+    }
+    template<typename Default, typename ... Handlers>
+    auto operator()(const Char* str, size_t length, Default&& fallback, Handlers&& ... handlers) const
+        -> decltype(fallback()) {
+        static_assert(sizeof ... (Handlers) == Count, "Number of handlers differs from number of labels");
+        using result = decltype(fallback());
+        const size_t found = index(str, length);
+        if (found == npos)
+            return static_cast<result>(fallback());
+        auto targets = std::forward_as_tuple(std::forward<Handlers>(handlers) ...);
+        return __static_string_detail::dispatch<result>(targets, found,
+            __static_string_detail::make_index_sequence<Count>{});
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    size_t index(std::basic_string_view<Char> str) const {
+        return index(str.data(), str.size());
+    }
+    template<typename Default, typename ... Handlers>
+    auto operator()(std::basic_string_view<Char> str, Default&& fallback, Handlers&& ... handlers) const
+        -> decltype(fallback()) {
+        return (*this)(str.data(), str.size(), std::forward<Default>(fallback), std::forward<Handlers>(handlers) ...);
+    }
+#endif
+    Char keys[Length + 1];
+    __static_string_detail::static_string_switch_entry<Char> entries[Count > 0 ? Count : 1];
+    size_t group_begin[MaxLength + 2];
+    size_t pivots[MaxLength + 1];
+};
+
+namespace __static_string_detail {
+
+template<typename Char, size_t Count, size_t Length, size_t MaxLength, size_t Size>
+constexpr int add(basic_static_string_switch<Char, Count, Length, MaxLength>& table,
+    size_t& count, size_t& offset, const basic_static_string<Char, Size>& label) {
+    for (size_t i = 0; i < Size - 1; ++i)
+        table.keys[offset + i] = label.data[i];
+    table.entries[count] = {offset, Size - 1, count, static_cast<Char>('\0')};
+    offset += Size - 1;
+    ++count;
+    return 0;
+}
+
+template<typename Char, size_t Count, size_t Length, size_t MaxLength, typename ... Labels>
+constexpr basic_static_string_switch<Char, Count, Length, MaxLength> make_static_string_switch(const Labels& ... labels) {
+    using entry = static_string_switch_entry<Char>;
+    basic_static_string_switch<Char, Count, Length, MaxLength> table{};
+    size_t count = 0, offset = 0;
+    int unused[] = {0, add(table, count, offset, labels) ...};
+    static_cast<void>(unused);
+    // group the labels by length keeping their order
+    for (size_t i = 1; i < Count; ++i) {
+        const entry current = table.entries[i];
+        size_t j = i;
+        for (; j > 0 && table.entries[j - 1].length > current.length; --j)
+            table.entries[j] = table.entries[j - 1];
+        table.entries[j] = current;
+    }
+    for (size_t length = 0, i = 0; length <= MaxLength + 1; ++length) {
+        for (; i < Count && table.entries[i].length < length; ++i) {}
+        table.group_begin[length] = i;
+    }
+    // find a position where all labels of the same length differ, so that a single
+    // character selects the only candidate for the final comparison
+    for (size_t length = 0; length <= MaxLength; ++length) {
+        const size_t begin = table.group_begin[length], end = table.group_begin[length + 1];
+        for (size_t i = begin; i < end; ++i)
+            for (size_t j = i + 1; j < end; ++j)
+                if (equal(table.keys + table.entries[i].offset, table.keys + table.entries[j].offset, length))
+                    throw std::invalid_argument("static_string_switch: duplicate label");
+        table.pivots[length] = basic_static_string_switch<Char, Count, Length, MaxLength>::npos;
+        for (size_t pivot = 0; end - begin > 1 && pivot < length; ++pivot) {
+            bool distinct = true;
+            for (size_t i = begin; i < end && distinct; ++i)
+                for (size_t j = i + 1; j < end && distinct; ++j)
+                    distinct = table.keys[table.entries[i].offset + pivot] != table.keys[table.entries[j].offset + pivot];
+            if (distinct) {
+                table.pivots[length] = pivot;
+                for (size_t i = begin; i < end; ++i)
+                    table.entries[i].pivot = table.keys[table.entries[i].offset + pivot];
+                break;
+            }
+        }
+    }
+    return table;
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t ... Sizes>
+constexpr auto make_static_string_switch(const basic_static_string<Char, Sizes>& ... labels) {
+    return __static_string_detail::make_static_string_switch<Char, sizeof ... (Sizes),
+        __static_string_detail::sum({(Sizes - 1) ...}), __static_string_detail::max({(Sizes - 1) ...})>(labels ...);
+}
+
+namespace __static_string_detail {
+
+template<typename Char, size_t Count, size_t Length>
+struct static_string_table_builder {
+    template<size_t Size> constexpr int add(const basic_static_string<Char, Size>& str) {
+        for (size_t i = 0; i < Size - 1; ++i)
+            data[offset + i] = str.data[i];
+        offsets[count] = offset;
+        lengths[count++] = Size - 1;
+        offset += Size - 1;
+        return 0;
+    }
+    // lays out the strings longest first, storing a string that is a suffix of an
+    // already stored one inside its tail; returns the number of characters used
+    constexpr size_t merge(Char* table, size_t* table_offsets, size_t capacity) const {
+        size_t order[Count > 0 ? Count : 1]{};
+        for (size_t i = 0; i < Count; ++i) {
+            size_t j = i;
+            for (; j > 0 && lengths[order[j - 1]] < lengths[i]; --j)
+                order[j] = order[j - 1];
+            order[j] = i;
+        }
+        size_t used = 0;
+        for (size_t i = 0; i < Count; ++i) {
+            const size_t current = order[i];
+            size_t found = std::numeric_limits<size_t>::max();
+            for (size_t j = 0; j < i && found == std::numeric_limits<size_t>::max(); ++j) {
+                const size_t stored = order[j];
+                const size_t tail = offsets[stored] + lengths[stored] - lengths[current];
+                if (equal(data + tail, data + offsets[current], lengths[current]))
+                    found = table_offsets[stored] + lengths[stored] - lengths[current];
+            }
+            if (found == std::numeric_limits<size_t>::max()) {
+                found = used;
+                if (table != nullptr) {
+                    if (used + lengths[current] + 1 > capacity)
+                        throw std::length_error("static_string_table: table length is too small");
+                    for (size_t k = 0; k < lengths[current]; ++k)
+                        table[used + k] = data[offsets[current] + k];
+                    table[used + lengths[current]] = static_cast<Char>('\0');
+                }
+                used += lengths[current] + 1;
+            }
+            table_offsets[current] = found;
+        }
+        return used;
+    }
+    Char data[Length + 1];
+    size_t offsets[Count > 0 ? Count : 1];
+    size_t lengths[Count > 0 ? Count : 1];
+    size_t count;
+    size_t offset;
+};
+
+template<typename Char, size_t ... Sizes>
+constexpr auto make_static_string_table_builder(const basic_static_string<Char, Sizes>& ... strs) {
+    static_string_table_builder<Char, sizeof ... (Sizes), sum({(Sizes - 1) ...})> builder{};
+    int unused[] = {0, builder.add(strs) ...};
+    static_cast<void>(unused);
+    return builder;
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Count, size_t Length> struct basic_static_string_table {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    constexpr size_t size() const {
+        return Count;
+    }
+    constexpr size_t length() const {
+        return Length;
+    }
+    constexpr size_t offset(size_t index) const {
+        return offsets[index];
+    }
+    constexpr size_t length(size_t index) const {
+        return lengths[index];
+    }
+    constexpr const Char* c_str(size_t index) const {
+        return data + offsets[index];
+    }
+    constexpr const Char* operator[](size_t index) const {
+        return data + offsets[index];
+    }
+    template<size_t Size> constexpr size_t offset_of(const basic_static_string<Char, Size>& str) const {
+        for (size_t i = 0; i < Count; ++i)
+            if (lengths[i] == Size - 1 && __static_string_detail::equal(data + offsets[i], &str.data[0], Size - 1))
+                return offsets[i];
+        return npos;
+    }
+    template<size_t Size> constexpr size_t offset_of(const Char (& str)[Size]) const {
+        return offset_of(__static_string_detail::make(str));
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    constexpr std::basic_string_view<Char> view(size_t index) const {
+        return std::basic_string_view<Char>(data + offsets[index], lengths[index]);
+    }
+#endif
+    Char data[Length > 0 ? Length : 1];
+    size_t offsets[Count > 0 ? Count : 1];
+    size_t lengths[Count > 0 ? Count : 1];
+};
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_string_table_length(const basic_static_string<Char, Sizes>& ... strs) {
+    const auto builder = __static_string_detail::make_static_string_table_builder(strs ...);
+    size_t offsets[sizeof ... (Sizes) > 0 ? sizeof ... (Sizes) : 1]{};
+    return builder.merge(nullptr, offsets, 0);
+}
+
+template<size_t Length, typename Char, size_t ... Sizes>
+constexpr basic_static_string_table<Char, sizeof ... (Sizes), Length> make_static_string_table(
+    const basic_static_string<Char, Sizes>& ... strs) {
+    const auto builder = __static_string_detail::make_static_string_table_builder(strs ...);
+    basic_static_string_table<Char, sizeof ... (Sizes), Length> table{};
+    builder.merge(table.data, table.offsets, Length);
+    for (size_t i = 0; i < sizeof ... (Sizes); ++i)
+        table.lengths[i] = builder.lengths[i];
+    return table;
+}
+
+namespace __static_string_detail {
+
+// the same order as operator<
+template<typename Char>
+constexpr int compare_keys(const Char* str1, size_t length1, const Char* str2, size_t length2) {
+    for (size_t i = 0; i < length1 && i < length2; ++i)
+        if (str1[i] != str2[i])
+            return str1[i] < str2[i] ? -1 : 1;
+    return length1 < length2 ? -1 : length1 > length2 ? 1 : 0;
+}
+
+// the first characters packed most significant first and zero padded, so that prefixes compared
+// as integers never contradict compare_keys(); signed characters are biased to compare as unsigned
+template<typename Char>
+constexpr unsigned long long key_prefix(const Char* str, size_t length) {
+    using unsigned_char = typename std::make_unsigned<Char>::type;
+    constexpr size_t bits = sizeof(Char) * 8;
+    constexpr unsigned long long bias = std::is_signed<Char>::value ? 1ULL << (bits - 1) : 0ULL;
+    unsigned long long result = 0;
+    for (size_t i = 0; i < 64 / bits; ++i)
+        result = (result << bits) |
+            (i < length ? static_cast<unsigned long long>(static_cast<unsigned_char>(str[i])) ^ bias : 0ULL);
+    return result;
+}
+
+struct static_string_set_node {
+    unsigned long long prefix;
+    size_t offset;
+    size_t length;
+};
+
+template<typename Char>
+constexpr bool less(const Char* keys, const static_string_set_node& node, const Char* key, size_t length,
+    unsigned long long prefix) {
+    return node.prefix != prefix ? node.prefix < prefix : compare_keys(keys + node.offset, node.length, key, length) < 0;
+}
+
+constexpr size_t trailing_ones(size_t value) {
+#ifdef __GNUC__
+    return static_cast<size_t>(__builtin_ctzll(~static_cast<unsigned long long>(value)));
+#else
+    size_t ones = 0;
+    for (; (value & 1) != 0; value >>= 1)
+        ++ones;
+    return ones;
+#endif
+}
+
+template<typename Less>
+constexpr void sift_down(size_t* order, size_t root, size_t count, const Less& less) {
+    for (size_t child = 2 * root + 1; child < count; root = child, child = 2 * root + 1) {
+        if (child + 1 < count && less(order[child], order[child + 1]))
+            ++child;
+        if (!less(order[root], order[child]))
+            return;
+        const size_t swapped = order[root];
+        order[root] = order[child];
+        order[child] = swapped;
+    }
+}
+
+template<typename Less>
+constexpr void heap_sort(size_t* order, size_t count, const Less& less) {
+    for (size_t i = count / 2; i > 0; --i)
+        sift_down(order, i - 1, count, less);
+    for (size_t i = count; i > 1; --i) {
+        const size_t swapped = order[0];
+        order[0] = order[i - 1];
+        order[i - 1] = swapped;
+        sift_down(order, 0, i - 1, less);
+    }
+}
+
+template<typename Builder>
+struct builder_less {
+    constexpr bool operator()(size_t index1, size_t index2) const {
+        return compare_keys(builder.data + builder.offsets[index1], builder.lengths[index1],
+            builder.data + builder.offsets[index2], builder.lengths[index2]) < 0;
+    }
+    const Builder& builder;
+};
+
+} // namespace __static_string_detail
+
+// keys sorted by operator< in one zero separated blob, indexed by nodes in Eytzinger (BFS) order:
+// node k has the children 2k and 2k + 1, node 0 is unused, so the top levels of the search
+// share cache lines and the next levels can be prefetched
+template<typename Char, size_t Count, size_t Length> struct basic_static_string_set {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    constexpr size_t size() const {
+        return Count;
+    }
+    constexpr bool empty() const {
+        return Count == 0;
+    }
+    constexpr const Char* operator[](size_t index) const {
+        return keys + nodes[slots[index]].offset;
+    }
+    constexpr const Char* c_str(size_t index) const {
+        return keys + nodes[slots[index]].offset;
+    }
+    constexpr size_t length(size_t index) const {
+        return nodes[slots[index]].length;
+    }
+    // the node loop steps right while the node is less than the key, without a branch on the
+    // result; undoing the trailing right steps gives the first node that is not less
+    constexpr size_t lower_bound(const Char* key, size_t length, unsigned long long prefix) const {
+        size_t k = 1;
+        while (k <= Count)
+            k = 2 * k + __static_string_detail::less(keys, nodes[k], key, length, prefix);
+        return ranks[k >> (__static_string_detail::trailing_ones(k) + 1)];
+    }
+    template<size_t Size> constexpr size_t lower_bound(const basic_static_string<Char, Size>& key) const {
+        return lower_bound(&key.data[0], Size - 1, __static_string_detail::key_prefix(&key.data[0], Size - 1));
+    }
+    template<size_t Size> constexpr size_t lower_bound(const Char (& key)[Size]) const {
+        return lower_bound(__static_string_detail::make(key));
+    }
+    size_t lower_bound(const Char* key, size_t length) const {
+        const unsigned long long prefix = __static_string_detail::key_prefix(key, length);
+        size_t k = 1;
+        while (k <= Count) {
+#ifdef __GNUC__
+            __builtin_prefetch(nodes + (4 * k <= Count ? 4 * k : 0));
+#endif
+            k = 2 * k + __static_string_detail::less(keys, nodes[k], key, length, prefix);
+        }
+        return ranks[k >> (__static_string_detail::trailing_ones(k) + 1)];
+    }
+    template<size_t Size> constexpr size_t index(const basic_static_string<Char, Size>& key) const {
+        const size_t rank = lower_bound(key);
+        return rank < Count && nodes[slots[rank]].length == Size - 1 &&
+            __static_string_detail::equal(keys + nodes[slots[rank]].offset, &key.data[0], Size - 1) ? rank : npos;
+    }
+    template<size_t Size> constexpr size_t index(const Char (& key)[Size]) const {
+        return index(__static_string_detail::make(key));
+    }
+    size_t index(const Char* key, size_t length) const {
+        const size_t rank = lower_bound(key, length);
+        return rank < Count && nodes[slots[rank]].length == length &&
+            std::char_traits<Char>::compare(keys + nodes[slots[rank]].offset, key, length) == 0 ? rank : npos;
+    }
+    template<size_t Size> constexpr bool contains(const basic_static_string<Char, Size>& key) const {
+        return index(key) != npos;
+    }
+    template<size_t Size> constexpr bool contains(const Char (& key)[Size]) const {
+        return index(key) != npos;
+    }
+    bool contains(const Char* key, size_t length) const {
+        return index(key, length) != npos;
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    constexpr std::basic_string_view<Char> view(size_t index) const {
+        return std::basic_string_view<Char>(c_str(index), length(index));
+    }
+    size_t lower_bound(std::basic_string_view<Char> key) const {
+        return lower_bound(key.data(), key.size());
+    }
+    size_t index(std::basic_string_view<Char> key) const {
+        return index(key.data(), key.size());
+    }
+    bool contains(std::basic_string_view<Char> key) const {
+        return index(key.data(), key.size()) != npos;
+    }
+#endif
+    Char keys[Length + 1];
+    __static_string_detail::static_string_set_node nodes[Count + 1];
+    size_t ranks[Count + 1];
+    size_t slots[Count > 0 ? Count : 1];
+};
+
+template<size_t Count, size_t Length>
+using static_string_set = basic_static_string_set<char, Count, Length>;
+template<size_t Count, size_t Length>
+using static_wstring_set = basic_static_string_set<wchar_t, Count, Length>;
+
+namespace __static_string_detail {
+
+// gives the nodes of the subtree at node in order the ranks from rank on, returns the next rank
+template<typename Char, size_t Count, size_t Length>
+constexpr size_t place(basic_static_string_set<Char, Count, Length>& set, const size_t* offsets, size_t node, size_t rank) {
+    if (node > Count)
+        return rank;
+    rank = place(set, offsets, 2 * node, rank);
+    set.nodes[node].offset = offsets[rank];
+    set.ranks[node] = rank;
+    set.slots[rank] = node;
+    return place(set, offsets, 2 * node + 1, rank + 1);
+}
+
+template<typename Char, size_t Count, size_t Length, typename ... Strs>
+constexpr basic_static_string_set<Char, Count, Length> make_static_string_set(const Strs& ... strs) {
+    static_string_table_builder<Char, Count, Length - Count> builder{};
+    int unused[] = {0, builder.add(strs) ...};
+    static_cast<void>(unused);
+    size_t order[Count > 0 ? Count : 1]{};
+    for (size_t i = 0; i < Count; ++i)
+        order[i] = i;
+    heap_sort(order, Count, builder_less<decltype(builder)>{builder});
+    basic_static_string_set<Char, Count, Length> set{};
+    size_t offsets[Count > 0 ? Count : 1]{};
+    size_t offset = 0;
+    for (size_t rank = 0; rank < Count; ++rank) {
+        const size_t key = order[rank];
+        if (rank > 0 && !builder_less<decltype(builder)>{builder}(order[rank - 1], key))
+            throw std::invalid_argument("static_string_set: duplicate key");
+        offsets[rank] = offset;
+        for (size_t i = 0; i < builder.lengths[key]; ++i)
+            set.keys[offset + i] = builder.data[builder.offsets[key] + i];
+        offset += builder.lengths[key] + 1;
+    }
+    place(set, offsets, 1, 0);
+    set.ranks[0] = Count;
+    for (size_t node = 1; node <= Count; ++node) {
+        const size_t rank = set.ranks[node];
+        set.nodes[node].length = builder.lengths[order[rank]];
+        set.nodes[node].prefix = key_prefix(set.keys + set.nodes[node].offset, set.nodes[node].length);
+    }
+    return set;
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t ... Sizes>
+constexpr auto make_static_string_set(const basic_static_string<Char, Sizes>& ... keys) {
+    return __static_string_detail::make_static_string_set<Char, sizeof ... (Sizes),
+        __static_string_detail::sum({Sizes ...})>(keys ...);
+}
+
+namespace __static_string_detail {
+
+struct digit_table {
+    char pairs[200];
+    char quads[40000];
+    unsigned long long powers[20];
+};
+
+// the digits of 100 + i are '1' and the zero-padded pair of i
+template<char One, char Tens, char Ones>
+constexpr char pair_digit(char_sequence<char, One, Tens, Ones>, size_t index) {
+    return index == 0 ? Tens : Ones;
+}
+
+template<size_t ... Indexes>
+constexpr digit_table make_digit_table(index_sequence<Indexes ...>) {
+    digit_table table{{pair_digit(make_uint_char_sequence<100 + Indexes / 2, char>{}, Indexes % 2) ...}, {}, {}};
+    for (size_t i = 0; i < 10000; ++i) {
+        table.quads[4 * i] = table.pairs[2 * (i / 100)];
+        table.quads[4 * i + 1] = table.pairs[2 * (i / 100) + 1];
+        table.quads[4 * i + 2] = table.pairs[2 * (i % 100)];
+        table.quads[4 * i + 3] = table.pairs[2 * (i % 100) + 1];
+    }
+    table.powers[0] = 1;
+    for (size_t i = 1; i < 20; ++i)
+        table.powers[i] = table.powers[i - 1] * 10;
+    return table;
+}
+
+template<typename Dummy = void> struct digit_tables {
+    static constexpr digit_table value = make_digit_table(make_index_sequence<200>{});
+};
+
+#ifndef __cpp_inline_variables
+template<typename Dummy>
+constexpr digit_table digit_tables<Dummy>::value;
+#endif
+
+inline size_t bit_width(unsigned long long value) {
+#ifdef __GNUC__
+    return 64 - static_cast<size_t>(__builtin_clzll(value | 1));
+#else
+    size_t bits = 1;
+    for (value >>= 1; value != 0; value >>= 1)
+        ++bits;
+    return bits;
+#endif
+}
+
+// 1233 / 4096 approximates log10(2), the power table corrects the guess by one
+inline size_t digit_count(unsigned long long value) {
+    const size_t guess = bit_width(value) * 1233 >> 12;
+    return guess + 1 - ((value | 1) < digit_tables<>::value.powers[guess] ? 1 : 0);
+}
+
+template<typename Char>
+inline void copy_digits(Char* out, const char* digits, size_t count) {
+    for (size_t i = 0; i < count; ++i)
+        out[i] = static_cast<Char>(digits[i]);
+}
+
+inline void copy_digits(char* out, const char* digits, size_t count) {
+    std::memcpy(out, digits, count);
+}
+
+// four digits per division from the back, the last one to four digits are the tail of a table entry
+template<typename Char, typename T>
+inline Char* write_digits(Char* out, T value) {
+    const digit_table& table = digit_tables<>::value;
+    const size_t size = digit_count(value);
+    Char* position = out + size;
+    for (; value >= 10000; value /= 10000) {
+        position -= 4;
+        copy_digits(position, table.quads + 4 * static_cast<size_t>(value % 10000), 4);
+    }
+    const size_t rest = static_cast<size_t>(position - out);
+    copy_digits(out, table.quads + 4 * static_cast<size_t>(value) + 4 - rest, rest);
+    return out + size;
+}
+
+// eight digits per 64-bit division until the rest fits in 32 bits
+template<typename Char>
+inline Char* write_digits(Char* out, unsigned long long value) {
+    if (value <= 0xFFFFFFFFULL)
+        return write_digits(out, static_cast<std::uint32_t>(value));
+    const digit_table& table = digit_tables<>::value;
+    const size_t size = digit_count(value);
+    Char* position = out + size;
+    for (; value > 0xFFFFFFFFULL; value /= 100000000) {
+        const std::uint32_t low = static_cast<std::uint32_t>(value % 100000000);
+        position -= 8;
+        copy_digits(position, table.quads + 4 * (low / 10000), 4);
+        copy_digits(position + 4, table.quads + 4 * (low % 10000), 4);
+    }
+    write_digits(out, static_cast<std::uint32_t>(value));
+    return out + size;
+}
+
+} // namespace __static_string_detail
+
+// writes the decimal digits of value without a terminating zero and returns the end,
+// out needs room for std::numeric_limits<T>::digits10 + 1 characters
+template<typename Char, typename T>
+inline Char* write_uint(Char* out, T value) {
+    static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value, "T must be an unsigned integer type");
+    return __static_string_detail::write_digits(out, static_cast<unsigned long long>(value));
+}
+
+// the same with a leading '-' for negative values, one more character
+template<typename Char, typename T>
+inline Char* write_int(Char* out, T value) {
+    static_assert(std::is_integral<T>::value && std::is_signed<T>::value, "T must be a signed integer type");
+    using unsigned_type = typename std::make_unsigned<T>::type;
+    unsigned_type magnitude = static_cast<unsigned_type>(value);
+    if (value < 0) {
+        *out++ = static_cast<Char>('-');
+        magnitude = static_cast<unsigned_type>(0) - magnitude;
+    }
+    return write_uint(out, magnitude);
+}
+
+namespace __static_string_detail {
+
+template<typename Char, size_t Size>
+constexpr size_t format_slots(const basic_static_string<Char, Size>& fmt) {
+    size_t slots = 0;
+    for (size_t i = 0; i < Size - 1; ++i) {
+        if (fmt.data[i] == static_cast<Char>('{')) {
+            if (i + 1 < Size - 1 && fmt.data[i + 1] == static_cast<Char>('}'))
+                ++slots;
+            else if (i + 1 >= Size - 1 || fmt.data[i + 1] != static_cast<Char>('{'))
+                throw std::invalid_argument("static_format: '{' must be followed by '}' or '{'");
+            ++i;
+        } else if (fmt.data[i] == static_cast<Char>('}')) {
+            if (i + 1 >= Size - 1 || fmt.data[i + 1] != static_cast<Char>('}'))
+                throw std::invalid_argument("static_format: unmatched '}'");
+            ++i;
+        }
+    }
+    return slots;
+}
+
+template<typename Char, typename T, typename Enable = void>
+struct format_argument;
+
+template<typename Char, typename T>
+struct format_argument<Char, T, typename std::enable_if<std::is_integral<T>::value &&
+    !std::is_same<T, bool>::value && !std::is_same<T, Char>::value && !std::is_same<T, char>::value>::type> {
+    static constexpr size_t bound() {
+        return std::numeric_limits<T>::digits10 + 1 + std::is_signed<T>::value;
+    }
+    static size_t size(T) {
+        return bound();
+    }
+    static Char* write(Char* out, T value) {
+        return write(out, value, std::is_signed<T>{});
+    }
+    static Char* write(Char* out, T value, std::true_type) {
+        return write_int(out, value);
+    }
+    static Char* write(Char* out, T value, std::false_type) {
+        return write_uint(out, value);
+    }
+};
+
+template<typename Char>
+struct format_argument<Char, Char> {
+    static constexpr size_t bound() {
+        return 1;
+    }
+    static size_t size(Char) {
+        return 1;
+    }
+    static Char* write(Char* out, Char value) {
+        *out = value;
+        return out + 1;
+    }
+};
+
+// a char in a wide format is a character too, its byte value is the code point as for ASCII and Latin-1
+template<typename Char>
+struct format_argument<Char, char, typename std::enable_if<!std::is_same<Char, char>::value>::type> {
+    static constexpr size_t bound() {
+        return 1;
+    }
+    static size_t size(char) {
+        return 1;
+    }
+    static Char* write(Char* out, char value) {
+        *out = static_cast<Char>(static_cast<unsigned char>(value));
+        return out + 1;
+    }
+};
+
+template<typename Char>
+struct format_argument<Char, bool> {
+    static constexpr size_t bound() {
+        return 5;
+    }
+    static size_t size(bool) {
+        return 5;
+    }
+    static Char* write(Char* out, bool value) {
+        const char* text = value ? "true" : "false";
+        for (; *text != '\0'; ++text)
+            *out++ = static_cast<Char>(*text);
+        return out;
+    }
+};
+
+// the shortest text that reads back to the value, as FTOSS and DTOSS write it, whatever the C locale
+template<typename Char, typename T>
+struct format_argument<Char, T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static constexpr size_t bound() {
+        // sign, digits, point, e, exponent sign and up to four exponent digits; fixed is only picked when shorter
+        return std::numeric_limits<T>::max_digits10 + 8;
+    }
+    static size_t size(T) {
+        return bound();
+    }
+    static Char* write(Char* out, T value) {
+        const auto text = format_float(value, float_format::general);
+        for (size_t i = 0; i < text.size; ++i)
+            *out++ = static_cast<Char>(text.text[i]);
+        return out;
+    }
+};
+
+template<typename Char, size_t Size>
+struct format_argument<Char, basic_static_string<Char, Size>> {
+    static constexpr size_t bound() {
+        return Size - 1;
+    }
+    static size_t size(const basic_static_string<Char, Size>&) {
+        return Size - 1;
+    }
+    static Char* write(Char* out, const basic_static_string<Char, Size>& value) {
+        std::char_traits<Char>::copy(out, &value.data[0], Size - 1);
+        return out + Size - 1;
+    }
+};
+
+template<typename Char>
+struct format_argument<Char, const Char*> {
+    static size_t size(const Char* value) {
+        return std::char_traits<Char>::length(value);
+    }
+    static Char* write(Char* out, const Char* value) {
+        const size_t length = std::char_traits<Char>::length(value);
+        std::char_traits<Char>::copy(out, value, length);
+        return out + length;
+    }
+};
+
+template<typename Char>
+struct format_argument<Char, Char*> : format_argument<Char, const Char*> {};
+
+template<typename Char, size_t Size>
+struct format_argument<Char, Char[Size]> {
+    static constexpr size_t bound() {
+        return Size - 1;
+    }
+    static size_t size(const Char (&)[Size]) {
+        return Size - 1;
+    }
+    // a literal, or a buffer holding a shorter null-terminated string
+    static Char* write(Char* out, const Char (& value)[Size]) {
+        const Char* end = std::char_traits<Char>::find(value, Size - 1, static_cast<Char>('\0'));
+        const size_t length = end != nullptr ? end - value : Size - 1;
+        std::char_traits<Char>::copy(out, value, length);
+        return out + length;
+    }
+};
+
+template<typename Char, typename Traits, typename Alloc>
+struct format_argument<Char, std::basic_string<Char, Traits, Alloc>> {
+    static size_t size(const std::basic_string<Char, Traits, Alloc>& value) {
+        return value.size();
+    }
+    static Char* write(Char* out, const std::basic_string<Char, Traits, Alloc>& value) {
+        std::char_traits<Char>::copy(out, value.data(), value.size());
+        return out + value.size();
+    }
+};
+
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+template<typename Char, typename Traits>
+struct format_argument<Char, std::basic_string_view<Char, Traits>> {
+    static size_t size(std::basic_string_view<Char, Traits> value) {
+        return value.size();
+    }
+    static Char* write(Char* out, std::basic_string_view<Char, Traits> value) {
+        std::char_traits<Char>::copy(out, value.data(), value.size());
+        return out + value.size();
+    }
+};
+#endif
+
+template<typename Char, typename T>
+using format_argument_t = format_argument<Char, typename std::remove_cv<typename std::remove_reference<T>::type>::type>;
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Length, size_t Slots> struct basic_static_format {
+    constexpr size_t slots() const {
+        return Slots;
+    }
+    constexpr size_t literal_length() const {
+        return segments[Slots + 1];
+    }
+    template<typename ... Args> constexpr size_t max_size() const {
+        static_assert(sizeof ... (Args) == Slots, "number of arguments does not match number of slots");
+        return literal_length() + __static_string_detail::sum({__static_string_detail::format_argument_t<Char, Args>::bound() ...});
+    }
+    template<typename ... Args> size_t max_size(const Args& ... args) const {
+        static_assert(sizeof ... (Args) == Slots, "number of arguments does not match number of slots");
+        return literal_length() + __static_string_detail::sum({__static_string_detail::format_argument_t<Char, Args>::size(args) ...});
+    }
+    template<typename ... Args> size_t format(Char* buffer, size_t capacity, const Args& ... args) const {
+        if (max_size(args ...) > capacity)
+            throw std::length_error("static_format: buffer is smaller than max_size()");
+        return write(buffer, __static_string_detail::make_index_sequence<Slots>{}, args ...) - buffer;
+    }
+    template<size_t Capacity, typename ... Args> size_t format(Char (& buffer)[Capacity], const Args& ... args) const {
+        return format(&buffer[0], Capacity, args ...);
+    }
+    template<typename ... Args> std::basic_string<Char> str(const Args& ... args) const {
+        std::basic_string<Char> result(max_size(args ...), static_cast<Char>('\0'));
+        result.resize(write(&result[0], __static_string_detail::make_index_sequence<Slots>{}, args ...) - &result[0]);
+        return result;
+    }
+    template<size_t ... Indexes, typename ... Args>
+    Char* write(Char* out, __static_string_detail::index_sequence<Indexes ...>, const Args& ... args) const {
+        int unused[] = {0, (out = segment(out, Indexes), out = __static_string_detail::format_argument_t<Char, Args>::write(out, args), 0) ...};
+        static_cast<void>(unused);
+        return segment(out, Slots);
+    }
+    Char* segment(Char* out, size_t index) const {
+        std::char_traits<Char>::copy(out, text + segments[index], segments[index + 1] - segments[index]);
+        return out + segments[index + 1] - segments[index];
+    }
+    Char text[Length > 0 ? Length : 1];
+    size_t segments[Slots + 2];
+};
+
+template<typename Char, size_t Size>
+constexpr size_t static_string_format_slots(const basic_static_string<Char, Size>& fmt) {
+    return __static_string_detail::format_slots(fmt);
+}
+
+template<typename Char, size_t Size>
+constexpr size_t static_string_format_slots(const Char (& fmt)[Size]) {
+    return __static_string_detail::format_slots(__static_string_detail::make(fmt));
+}
+
+template<size_t Slots, typename Char, size_t Size>
+constexpr basic_static_format<Char, Size - 1, Slots> make_static_format(const basic_static_string<Char, Size>& fmt) {
+    if (__static_string_detail::format_slots(fmt) != Slots)
+        throw std::invalid_argument("static_format: number of slots does not match format string");
+    basic_static_format<Char, Size - 1, Slots> result{};
+    size_t length = 0, slot = 0;
+    for (size_t i = 0; i < Size - 1; ++i) {
+        if (fmt.data[i] == static_cast<Char>('{') && fmt.data[i + 1] == static_cast<Char>('}'))
+            result.segments[++slot] = length;
+        else
+            result.text[length++] = fmt.data[i];
+        if (fmt.data[i] == static_cast<Char>('{') || fmt.data[i] == static_cast<Char>('}'))
+            ++i;
+    }
+    result.segments[Slots + 1] = length;
+    return result;
+}
+
+template<size_t Slots, typename Char, size_t Size>
+constexpr basic_static_format<Char, Size - 1, Slots> make_static_format(const Char (& fmt)[Size]) {
+    return make_static_format<Slots>(__static_string_detail::make(fmt));
+}
+
+template<typename Char, size_t Capacity> struct basic_fixed_string;
+
+namespace __static_string_detail {
+
+template<typename Char>
+struct string_ref {
+    const Char* data;
+    size_t size;
+};
+
+template<typename Char, size_t Capacity>
+string_ref<Char> make_ref(const basic_fixed_string<Char, Capacity>& str) {
+    return {str.data(), str.size()};
+}
+
+template<typename Char, size_t Size>
+constexpr string_ref<Char> make_ref(const basic_static_string<Char, Size>& str) {
+    return {&str.data[0], Size - 1};
+}
+
+template<typename Char, size_t Size>
+constexpr string_ref<Char> make_ref(const Char (& str)[Size]) {
+    return {str, Size - 1};
+}
+
+template<typename Char, typename Traits, typename Alloc>
+string_ref<Char> make_ref(const std::basic_string<Char, Traits, Alloc>& str) {
+    return {str.data(), str.size()};
+}
+
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+template<typename Char, typename Traits>
+string_ref<Char> make_ref(std::basic_string_view<Char, Traits> str) {
+    return {str.data(), str.size()};
+}
+#endif
+
+template<typename Char>
+int compare(string_ref<Char> str1, string_ref<Char> str2) {
+    const int result = std::char_traits<Char>::compare(str1.data, str2.data, str1.size < str2.size ? str1.size : str2.size);
+    return result != 0 ? result : str1.size < str2.size ? -1 : str1.size > str2.size ? 1 : 0;
+}
+
+template<typename T>
+struct is_fixed_string : std::false_type {};
+
+template<typename Char, size_t Capacity>
+struct is_fixed_string<basic_fixed_string<Char, Capacity>> : std::true_type {};
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Capacity> struct basic_fixed_string {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    basic_fixed_string() : used(0) {
+        buffer[0] = static_cast<Char>('\0');
+    }
+    template<size_t Size> basic_fixed_string(const basic_static_string<Char, Size>& str) : used(0) {
+        static_assert(Size - 1 <= Capacity, "static string is longer than capacity");
+        assign(&str.data[0], Size - 1);
+    }
+    basic_fixed_string(const basic_fixed_string& str) : used(str.used) {
+        std::char_traits<Char>::copy(buffer, str.buffer, used + 1);
+    }
+    template<size_t OtherCapacity> explicit basic_fixed_string(const basic_fixed_string<Char, OtherCapacity>& str) : used(0) {
+        assign(str.data(), str.size());
+    }
+    basic_fixed_string(const Char* str, size_t length) : used(0) {
+        assign(str, length);
+    }
+    explicit basic_fixed_string(const Char* str) : used(0) {
+        assign(str, std::char_traits<Char>::length(str));
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    explicit basic_fixed_string(std::basic_string_view<Char> str) : used(0) {
+        assign(str.data(), str.size());
+    }
+#endif
+    basic_fixed_string& operator=(const basic_fixed_string& str) {
+        if (this != &str) {
+            used = str.used;
+            std::char_traits<Char>::copy(buffer, str.buffer, used + 1);
+        }
+        return *this;
+    }
+    size_t length() const {
+        return used;
+    }
+    size_t size() const {
+        return used;
+    }
+    static constexpr size_t capacity() {
+        return Capacity;
+    }
+    size_t begin() const {
+        return 0;
+    }
+    size_t end() const {
+        return used;
+    }
+    size_t rbegin() const {
+        return used - 1;
+    }
+    size_t rend() const {
+        return npos;
+    }
+    bool empty() const {
+        return used == 0;
+    }
+    const Char* data() const {
+        return buffer;
+    }
+    const Char* c_str() const {
+        return buffer;
+    }
+    Char operator[](size_t index) const {
+        return buffer[index];
+    }
+    Char& operator[](size_t index) {
+        return buffer[index];
+    }
+    void clear() {
+        resize(0);
+    }
+    void resize(size_t length, Char ch = static_cast<Char>('\0')) {
+        if (length > Capacity)
+            throw std::length_error("basic_fixed_string: length exceeds capacity");
+        for (size_t i = used; i < length; ++i)
+            buffer[i] = ch;
+        used = length;
+        buffer[used] = static_cast<Char>('\0');
+    }
+    basic_fixed_string& assign(const Char* str, size_t length) {
+        used = 0;
+        return append(str, length);
+    }
+    basic_fixed_string& append(const Char* str, size_t length) {
+        if (length > Capacity - used)
+            throw std::length_error("basic_fixed_string: length exceeds capacity");
+        std::char_traits<Char>::move(buffer + used, str, length);
+        used += length;
+        buffer[used] = static_cast<Char>('\0');
+        return *this;
+    }
+    basic_fixed_string& push_back(Char ch) {
+        return append(&ch, 1);
+    }
+    template<typename Str> auto operator+=(const Str& str) -> decltype(__static_string_detail::make_ref<Char>(str), *this) {
+        const auto ref = __static_string_detail::make_ref<Char>(str);
+        return append(ref.data, ref.size);
+    }
+    basic_fixed_string& operator+=(Char ch) {
+        return push_back(ch);
+    }
+    size_t find(Char ch, size_t from = 0, size_t nth = 0) const {
+        for (; from < used; ++from) {
+            const Char* found = std::char_traits<Char>::find(buffer + from, used - from, ch);
+            if (found == nullptr)
+                return npos;
+            from = found - buffer;
+            if (nth-- == 0)
+                return from;
+        }
+        return npos;
+    }
+    template<typename Str> auto find(const Str& substr, size_t from = 0, size_t nth = 0) const
+        -> decltype(__static_string_detail::make_ref<Char>(substr), size_t()) {
+        const auto ref = __static_string_detail::make_ref<Char>(substr);
+        if (ref.size == 0)
+            return from + nth <= used ? from + nth : npos;
+        for (; ref.size <= used && from <= used - ref.size; ++from) {
+            const Char* found = std::char_traits<Char>::find(buffer + from, used - ref.size + 1 - from, ref.data[0]);
+            if (found == nullptr)
+                return npos;
+            from = found - buffer;
+            if (std::char_traits<Char>::compare(found + 1, ref.data + 1, ref.size - 1) == 0 && nth-- == 0)
+                return from;
+        }
+        return npos;
+    }
+    size_t rfind(Char ch, size_t from = npos, size_t nth = 0) const {
+        if (used == 0)
+            return npos;
+        for (size_t i = (from < used - 1 ? from : used - 1) + 1; i > 0; --i)
+            if (buffer[i - 1] == ch && nth-- == 0)
+                return i - 1;
+        return npos;
+    }
+    template<typename Str> auto rfind(const Str& substr, size_t from = npos, size_t nth = 0) const
+        -> decltype(__static_string_detail::make_ref<Char>(substr), size_t()) {
+        const auto ref = __static_string_detail::make_ref<Char>(substr);
+        if (ref.size > used)
+            return npos;
+        for (size_t i = (from < used - ref.size ? from : used - ref.size) + 1; i > 0; --i)
+            if (std::char_traits<Char>::compare(buffer + i - 1, ref.data, ref.size) == 0 && nth-- == 0)
+                return i - 1;
+        return npos;
+    }
+    bool contains(Char ch) const {
+        return find(ch) != npos;
+    }
+    template<typename Str> auto contains(const Str& substr) const -> decltype(__static_string_detail::make_ref<Char>(substr), bool()) {
+        return find(substr) != npos;
+    }
+    template<typename Str> auto starts_with(const Str& prefix) const -> decltype(__static_string_detail::make_ref<Char>(prefix), bool()) {
+        const auto ref = __static_string_detail::make_ref<Char>(prefix);
+        return ref.size <= used && std::char_traits<Char>::compare(buffer, ref.data, ref.size) == 0;
+    }
+    template<typename Str> auto ends_with(const Str& suffix) const -> decltype(__static_string_detail::make_ref<Char>(suffix), bool()) {
+        const auto ref = __static_string_detail::make_ref<Char>(suffix);
+        return ref.size <= used && std::char_traits<Char>::compare(buffer + used - ref.size, ref.data, ref.size) == 0;
+    }
+    size_t count(Char ch) const {
+        size_t result = 0;
+        for (size_t i = 0; i < used; ++i)
+            result += buffer[i] == ch;
+        return result;
+    }
+    unsigned long long hash() const {
+        return static_string_hash(buffer, used);
+    }
+    template<typename Algo> unsigned long long hash(unsigned long long key0 = 0, unsigned long long key1 = 0) const {
+        return static_string_hash<Algo>(buffer, used, key0, key1);
+    }
+    std::basic_string<Char> str() const {
+        return std::basic_string<Char>(buffer, used);
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    std::basic_string_view<Char> view() const {
+        return std::basic_string_view<Char>(buffer, used);
+    }
+    operator std::basic_string_view<Char>() const {
+        return view();
+    }
+#endif
+    Char buffer[Capacity + 1]; // only the first used + 1 characters are ever written or read
+    size_t used;
+};
+
+template<size_t Capacity> using fixed_string = basic_fixed_string<char, Capacity>;
+template<size_t Capacity> using fixed_wstring = basic_fixed_string<wchar_t, Capacity>;
+
+template<typename Char, size_t Capacity>
+std::basic_ostream<Char>& operator<<(std::basic_ostream<Char>& bos, const basic_fixed_string<Char, Capacity>& str) {
+    if (bos.width() != 0)
+        return __static_string_detail::write_padded(bos, str.data(), str.size());
+    return bos.write(str.data(), str.size());
+}
+
+#define SNW1_FIXED_STRING_COMPARISON(op) \
+template<typename Char, size_t Capacity, typename Str> \
+auto operator op(const basic_fixed_string<Char, Capacity>& str1, const Str& str2) \
+    -> decltype(__static_string_detail::make_ref<Char>(str2), bool()) { \
+    return __static_string_detail::compare(__static_string_detail::make_ref(str1), __static_string_detail::make_ref<Char>(str2)) op 0; \
+} \
+template<typename Str, typename Char, size_t Capacity> \
+auto operator op(const Str& str1, const basic_fixed_string<Char, Capacity>& str2) \
+    -> typename std::enable_if<!__static_string_detail::is_fixed_string<Str>::value, \
+        decltype(__static_string_detail::make_ref<Char>(str1), bool())>::type { \
+    return __static_string_detail::compare(__static_string_detail::make_ref<Char>(str1), __static_string_detail::make_ref(str2)) op 0; \
+}
+
+SNW1_FIXED_STRING_COMPARISON(==)
+SNW1_FIXED_STRING_COMPARISON(!=)
+SNW1_FIXED_STRING_COMPARISON(<)
+SNW1_FIXED_STRING_COMPARISON(<=)
+SNW1_FIXED_STRING_COMPARISON(>)
+SNW1_FIXED_STRING_COMPARISON(>=)
+
+#undef SNW1_FIXED_STRING_COMPARISON
+
+template<typename Char, size_t Capacity1, size_t Capacity2>
+basic_fixed_string<Char, Capacity1 + Capacity2> operator+(const basic_fixed_string<Char, Capacity1>& str1,
+    const basic_fixed_string<Char, Capacity2>& str2) {
+    basic_fixed_string<Char, Capacity1 + Capacity2> result(str1);
+    return result.append(str2.data(), str2.size());
+}
+
+template<typename Char, size_t Capacity, size_t Size>
+basic_fixed_string<Char, Capacity + Size - 1> operator+(const basic_fixed_string<Char, Capacity>& str1,
+    const basic_static_string<Char, Size>& str2) {
+    basic_fixed_string<Char, Capacity + Size - 1> result(str1);
+    return result.append(&str2.data[0], Size - 1);
+}
+
+template<typename Char, size_t Size, size_t Capacity>
+basic_fixed_string<Char, Size - 1 + Capacity> operator+(const basic_static_string<Char, Size>& str1,
+    const basic_fixed_string<Char, Capacity>& str2) {
+    basic_fixed_string<Char, Size - 1 + Capacity> result(str1);
+    return result.append(str2.data(), str2.size());
+}
+
+template<typename Char, size_t Capacity, size_t Size>
+basic_fixed_string<Char, Capacity + Size - 1> operator+(const basic_fixed_string<Char, Capacity>& str1, const Char (& str2)[Size]) {
+    basic_fixed_string<Char, Capacity + Size - 1> result(str1);
+    return result.append(str2, Size - 1);
+}
+
+template<typename Char, size_t Size, size_t Capacity>
+basic_fixed_string<Char, Size - 1 + Capacity> operator+(const Char (& str1)[Size], const basic_fixed_string<Char, Capacity>& str2) {
+    basic_fixed_string<Char, Size - 1 + Capacity> result(str1, Size - 1);
+    return result.append(str2.data(), str2.size());
+}
+
+template<typename Char, size_t Capacity> struct basic_bounded_string {
+    const Char* data;
+    size_t size;
+};
+
+template<size_t Capacity, typename Char>
+basic_bounded_string<Char, Capacity> bounded(const Char* str, size_t length) {
+    if (length > Capacity)
+        throw std::length_error("bounded: length exceeds capacity");
+    return {str, length};
+}
+
+template<size_t Capacity, typename Char, typename Traits, typename Alloc>
+basic_bounded_string<Char, Capacity> bounded(const std::basic_string<Char, Traits, Alloc>& str) {
+    return bounded<Capacity>(str.data(), str.size());
+}
+
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+template<size_t Capacity, typename Char, typename Traits>
+basic_bounded_string<Char, Capacity> bounded(std::basic_string_view<Char, Traits> str) {
+    return bounded<Capacity>(str.data(), str.size());
+}
+#endif
+
+namespace __static_string_detail {
+
+template<typename Char, size_t Capacity>
+struct format_argument<Char, basic_fixed_string<Char, Capacity>> {
+    static constexpr size_t bound() {
+        return Capacity;
+    }
+    static size_t size(const basic_fixed_string<Char, Capacity>& value) {
+        return value.size();
+    }
+    static Char* write(Char* out, const basic_fixed_string<Char, Capacity>& value) {
+        std::char_traits<Char>::copy(out, value.data(), value.size());
+        return out + value.size();
+    }
+};
+
+template<typename Char, size_t Capacity>
+struct format_argument<Char, basic_bounded_string<Char, Capacity>> {
+    static constexpr size_t bound() {
+        return Capacity;
+    }
+    static size_t size(const basic_bounded_string<Char, Capacity>& value) {
+        return value.size;
+    }
+    static Char* write(Char* out, const basic_bounded_string<Char, Capacity>& value) {
+        std::char_traits<Char>::copy(out, value.data, value.size);
+        return out + value.size;
+    }
+};
+
+template<typename T>
+struct string_char {
+    using type = void;
+};
+
+template<typename Char, size_t Size>
+struct string_char<basic_static_string<Char, Size>> {
+    using type = Char;
+};
+
+template<typename Char, size_t Capacity>
+struct string_char<basic_fixed_string<Char, Capacity>> {
+    using type = Char;
+};
+
+template<typename Char, size_t Capacity>
+struct string_char<basic_bounded_string<Char, Capacity>> {
+    using type = Char;
+};
+
+template<typename Char, size_t Size>
+struct string_char<Char[Size]> {
+    using type = Char;
+};
+
+template<typename ... Args>
+struct first_string_char {
+    using type = char;
+};
+
+template<typename Arg, typename ... Args>
+struct first_string_char<Arg, Args ...> {
+    using arg_char = typename string_char<typename std::remove_cv<Arg>::type>::type;
+    using type = typename std::conditional<std::is_void<arg_char>::value,
+        typename first_string_char<Args ...>::type, arg_char>::type;
+};
+
+} // namespace __static_string_detail
+
+template<typename ... Args>
+auto make_fixed_string(const Args& ... args) {
+    using Char = typename __static_string_detail::first_string_char<Args ...>::type;
+    basic_fixed_string<Char, __static_string_detail::sum({__static_string_detail::format_argument_t<Char, Args>::bound() ...})> result;
+    Char* out = result.buffer;
+    int unused[] = {0, (out = __static_string_detail::format_argument_t<Char, Args>::write(out, args), 0) ...};
+    static_cast<void>(unused);
+    result.used = out - result.buffer;
+    result.buffer[result.used] = static_cast<Char>('\0');
+    return result;
+}
+
+namespace __static_string_detail {
+
+// first/last character prefilter: a block of candidate positions is checked with
+// two vector compares, only positions where both characters match are compared fully;
+// each returns the match or npos and leaves from at the first position not yet checked
+#ifdef SNW1_STATIC_STRING_HAS_SSE2
+inline size_t lowest_bit(unsigned mask) {
+#ifdef __GNUC__
+    return static_cast<size_t>(__builtin_ctz(mask));
+#else
+    size_t bit = 0;
+    for (; (mask & 1) == 0; mask >>= 1)
+        ++bit;
+    return bit;
+#endif
+}
+
+inline size_t find_sse2(const char* str, size_t length, size_t& from, const char* needle, size_t size) {
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[size - 1]);
+    for (; from + size - 1 + 16 <= length; from += 16) {
+        const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + from));
+        const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + from + size - 1));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))));
+        for (; mask != 0; mask &= mask - 1)
+            if (std::memcmp(str + from + lowest_bit(mask) + 1, needle + 1, size - 2) == 0)
+                return from + lowest_bit(mask);
+    }
+    return std::numeric_limits<size_t>::max();
+}
+#endif
+
+#ifdef SNW1_STATIC_STRING_HAS_AVX2
+// vector extensions instead of <immintrin.h>, which costs more to parse than the rest of this header
+typedef char avx2_bytes __attribute__((vector_size(32)));
+
+__attribute__((target("avx2")))
+inline size_t find_avx2(const char* str, size_t length, size_t& from, const char* needle, size_t size) {
+    const avx2_bytes first = avx2_bytes{} + needle[0];
+    const avx2_bytes last = avx2_bytes{} + needle[size - 1];
+    for (; from + size - 1 + 32 <= length; from += 32) {
+        avx2_bytes block_first{}, block_last{};
+        std::memcpy(&block_first, str + from, sizeof(block_first));
+        std::memcpy(&block_last, str + from + size - 1, sizeof(block_last));
+        unsigned mask = static_cast<unsigned>(__builtin_ia32_pmovmskb256(
+            static_cast<avx2_bytes>((first == block_first) & (last == block_last))));
+        for (; mask != 0; mask &= mask - 1)
+            if (std::memcmp(str + from + lowest_bit(mask) + 1, needle + 1, size - 2) == 0)
+                return from + lowest_bit(mask);
+    }
+    return std::numeric_limits<size_t>::max();
+}
+
+// the first call may come from a static initializer that runs before the compiler's own cpu_init constructor
+inline bool has_avx2() {
+    static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+    return result;
+}
+#endif
+
+inline size_t find_vector(const char* str, size_t length, size_t& from, const char* needle, size_t size) {
+#ifdef SNW1_STATIC_STRING_HAS_AVX2
+    if (has_avx2()) {
+        const size_t result = find_avx2(str, length, from, needle, size);
+        if (result != std::numeric_limits<size_t>::max())
+            return result;
+    }
+#endif
+#ifdef SNW1_STATIC_STRING_HAS_SSE2
+    return find_sse2(str, length, from, needle, size);
+#else
+    static_cast<void>(str);
+    static_cast<void>(length);
+    static_cast<void>(from);
+    static_cast<void>(needle);
+    static_cast<void>(size);
+    return std::numeric_limits<size_t>::max();
+#endif
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Size> struct basic_static_searcher {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    constexpr size_t size() const {
+        return Size - 1;
+    }
+    constexpr size_t shift(Char ch) const {
+        return shifts[static_cast<unsigned char>(ch)];
+    }
+    size_t find(const Char* str, size_t length, size_t from = 0) const {
+        if (Size == 1)
+            return from <= length ? from : npos;
+        if (from > length || length - from < Size - 1)
+            return npos;
+        if (sizeof(Char) == 1 && Size > 2) {
+            const size_t result = __static_string_detail::find_vector(reinterpret_cast<const char*>(str), length, from,
+                reinterpret_cast<const char*>(needle), Size - 1);
+            if (result != npos)
+                return result;
+        }
+        return horspool(str, length, from);
+    }
+    template<typename Traits, typename Alloc>
+    size_t find(const std::basic_string<Char, Traits, Alloc>& str, size_t from = 0) const {
+        return find(str.data(), str.size(), from);
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    size_t find(std::basic_string_view<Char> str, size_t from = 0) const {
+        return find(str.data(), str.size(), from);
+    }
+#endif
+    size_t horspool(const Char* str, size_t length, size_t from) const {
+        const Char last = needle[Size - 2];
+        while (length - from >= Size - 1) {
+            const Char ch = str[from + Size - 2];
+            if (ch == last && std::char_traits<Char>::compare(str + from, needle, Size - 2) == 0)
+                return from;
+            from += shift(ch);
+        }
+        return npos;
+    }
+    Char needle[Size];
+    size_t shifts[256];
+};
+
+template<typename Char, size_t Size>
+constexpr basic_static_searcher<Char, Size> make_static_searcher(const basic_static_string<Char, Size>& str) {
+    basic_static_searcher<Char, Size> searcher{};
+    for (size_t i = 0; i < Size; ++i)
+        searcher.needle[i] = str.data[i];
+    for (size_t i = 0; i < 256; ++i)
+        searcher.shifts[i] = Size > 1 ? Size - 1 : 1;
+    // characters are bucketed by their low byte, so wide characters sharing it take the smallest shift
+    for (size_t i = 0; i + 2 < Size; ++i)
+        searcher.shifts[static_cast<unsigned char>(str.data[i])] = Size - 2 - i;
+    return searcher;
+}
+
+template<typename Char, size_t Size>
+constexpr basic_static_searcher<Char, Size> make_static_searcher(const Char (& str)[Size]) {
+    return make_static_searcher(__static_string_detail::make(str));
+}
+
+namespace __static_string_detail {
+
+template<typename Char>
+constexpr typename std::make_unsigned<Char>::type symbol_value(Char ch) {
+    return static_cast<typename std::make_unsigned<Char>::type>(ch);
+}
+
+template<typename Char>
+constexpr int compare(const Char* str1, size_t length1, const Char* str2, size_t length2) {
+    for (size_t i = 0; i < length1 && i < length2; ++i)
+        if (str1[i] != str2[i])
+            return symbol_value(str1[i]) < symbol_value(str2[i]) ? -1 : 1;
+    return length1 < length2 ? -1 : length1 > length2 ? 1 : 0;
+}
+
+// collects distinct characters of all keywords in ascending order, returns their number
+template<typename Builder, typename Char>
+constexpr size_t automaton_symbols(const Builder& builder, Char* symbols, size_t capacity) {
+    size_t count = 0;
+    for (size_t i = 0; i < builder.offset; ++i) {
+        const Char ch = builder.data[i];
+        size_t j = count;
+        for (; j > 0 && symbol_value(symbols[j - 1]) > symbol_value(ch); --j) {}
+        if (j > 0 && symbols[j - 1] == ch)
+            continue;
+        if (count == capacity)
+            throw std::length_error("static_string_automaton: too many character classes");
+        for (size_t k = count; k > j; --k)
+            symbols[k] = symbols[k - 1];
+        symbols[j] = ch;
+        ++count;
+    }
+    return count;
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Count, size_t States, size_t Classes> struct basic_static_string_automaton {
+    using state_type = typename std::conditional<States <= 0xFFFF, std::uint16_t, std::uint32_t>::type;
+    using class_type = typename std::conditional<Classes <= 0xFF, std::uint8_t, std::uint32_t>::type;
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    constexpr size_t size() const {
+        return Count;
+    }
+    constexpr size_t states() const {
+        return States;
+    }
+    constexpr size_t classes() const {
+        return Classes;
+    }
+    constexpr size_t length(size_t index) const {
+        return lengths[index];
+    }
+    // class 0 stands for every character that does not occur in the keywords
+    constexpr size_t class_of(Char ch) const {
+        if (__static_string_detail::symbol_value(ch) < 256)
+            return byte_classes[__static_string_detail::symbol_value(ch)];
+        size_t low = 1, high = Classes;
+        while (low < high) {
+            const size_t middle = low + (high - low) / 2;
+            if (__static_string_detail::symbol_value(symbols[middle]) < __static_string_detail::symbol_value(ch))
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return low < Classes && symbols[low] == ch ? low : 0;
+    }
+    constexpr size_t next(size_t state, Char ch) const {
+        return transitions[state * Classes + class_of(ch)];
+    }
+    // calls callback(keyword index, offset) for every match, offsets are counted from position;
+    // returns the state to pass with the next chunk of a stream
+    template<typename Callback> size_t scan(const Char* str, size_t length, Callback&& callback,
+        size_t state = 0, size_t position = 0) const {
+        for (size_t i = 0; i < length; ++i) {
+            state = transitions[state * Classes + class_of(str[i])];
+            for (size_t match = matches[state] != npos ? state : dictionary[state]; match != 0; match = dictionary[match])
+                callback(matches[match], position + i + 1 - lengths[matches[match]]);
+        }
+        return state;
+    }
+    template<typename Traits, typename Alloc, typename Callback>
+    size_t scan(const std::basic_string<Char, Traits, Alloc>& str, Callback&& callback, size_t state = 0, size_t position = 0) const {
+        return scan(str.data(), str.size(), std::forward<Callback>(callback), state, position);
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    template<typename Callback>
+    size_t scan(std::basic_string_view<Char> str, Callback&& callback, size_t state = 0, size_t position = 0) const {
+        return scan(str.data(), str.size(), std::forward<Callback>(callback), state, position);
+    }
+#endif
+    state_type transitions[States * Classes];
+    state_type dictionary[States];
+    size_t matches[States];
+    size_t lengths[Count > 0 ? Count : 1];
+    class_type byte_classes[256];
+    Char symbols[Classes];
+};
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_string_automaton_states(const basic_static_string<Char, Sizes>& ... keywords) {
+    // trie nodes: every keyword adds the characters it does not share with its sorted predecessor
+    const auto builder = __static_string_detail::make_static_string_table_builder(keywords ...);
+    size_t order[sizeof ... (Sizes) > 0 ? sizeof ... (Sizes) : 1]{};
+    size_t states = 1;
+    for (size_t i = 0; i < sizeof ... (Sizes); ++i) {
+        size_t j = i;
+        for (; j > 0 && __static_string_detail::compare(builder.data + builder.offsets[order[j - 1]], builder.lengths[order[j - 1]],
+            builder.data + builder.offsets[i], builder.lengths[i]) > 0; --j)
+            order[j] = order[j - 1];
+        order[j] = i;
+    }
+    for (size_t i = 0; i < sizeof ... (Sizes); ++i) {
+        size_t common = 0;
+        if (i > 0)
+            for (; common < builder.lengths[order[i]] && common < builder.lengths[order[i - 1]] &&
+                builder.data[builder.offsets[order[i]] + common] == builder.data[builder.offsets[order[i - 1]] + common]; ++common) {}
+        states += builder.lengths[order[i]] - common;
+    }
+    return states;
+}
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_string_automaton_classes(const basic_static_string<Char, Sizes>& ... keywords) {
+    const auto builder = __static_string_detail::make_static_string_table_builder(keywords ...);
+    Char symbols[__static_string_detail::sum({(Sizes - 1) ...}) + 1]{};
+    return __static_string_detail::automaton_symbols(builder, symbols, sizeof(symbols) / sizeof(Char)) + 1;
+}
+
+template<size_t States, size_t Classes, typename Char, size_t ... Sizes>
+constexpr basic_static_string_automaton<Char, sizeof ... (Sizes), States, Classes> make_static_string_automaton(
+    const basic_static_string<Char, Sizes>& ... keywords) {
+    constexpr size_t count = sizeof ... (Sizes);
+    const auto builder = __static_string_detail::make_static_string_table_builder(keywords ...);
+    basic_static_string_automaton<Char, count, States, Classes> automaton{};
+    const size_t symbols = __static_string_detail::automaton_symbols(builder, automaton.symbols + 1, Classes - 1);
+    for (size_t i = 1; i <= symbols; ++i)
+        if (__static_string_detail::symbol_value(automaton.symbols[i]) < 256)
+            automaton.byte_classes[__static_string_detail::symbol_value(automaton.symbols[i])] = i;
+    for (size_t i = symbols + 1; i < Classes; ++i)
+        automaton.symbols[i] = automaton.symbols[symbols];
+    for (size_t i = 0; i < States; ++i)
+        automaton.matches[i] = automaton.npos;
+    // trie
+    size_t states = 1;
+    for (size_t i = 0; i < count; ++i) {
+        if (builder.lengths[i] == 0)
+            throw std::invalid_argument("static_string_automaton: empty keyword");
+        size_t state = 0;
+        for (size_t j = 0; j < builder.lengths[i]; ++j) {
+            const size_t transition = state * Classes + automaton.class_of(builder.data[builder.offsets[i] + j]);
+            if (automaton.transitions[transition] == 0) {
+                if (states == States)
+                    throw std::length_error("static_string_automaton: too many states");
+                automaton.transitions[transition] = states++;
+            }
+            state = automaton.transitions[transition];
+        }
+        if (automaton.matches[state] != automaton.npos)
+            throw std::invalid_argument("static_string_automaton: duplicate keyword");
+        automaton.matches[state] = i;
+        automaton.lengths[i] = builder.lengths[i];
+    }
+    // failure links are folded into the transitions in breadth-first order
+    size_t fail[States]{};
+    size_t queue[States]{};
+    size_t head = 0, tail = 0;
+    for (size_t c = 0; c < Classes; ++c)
+        if (automaton.transitions[c] != 0)
+            queue[tail++] = automaton.transitions[c];
+    while (head < tail) {
+        const size_t state = queue[head++];
+        for (size_t c = 0; c < Classes; ++c) {
+            const size_t target = automaton.transitions[state * Classes + c];
+            const size_t fallback = automaton.transitions[fail[state] * Classes + c];
+            if (target == 0) {
+                automaton.transitions[state * Classes + c] = fallback;
+            } else {
+                fail[target] = fallback;
+                automaton.dictionary[target] = automaton.matches[fallback] != automaton.npos ? fallback : automaton.dictionary[fallback];
+                queue[tail++] = target;
+            }
+        }
+    }
+    return automaton;
+}
+
+template<size_t States, size_t Classes, typename Char, size_t ... Sizes>
+constexpr auto make_static_string_automaton(const Char (& ... keywords)[Sizes]) {
+    return make_static_string_automaton<States, Classes>(__static_string_detail::make(keywords) ...);
+}
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_string_automaton_states(const Char (& ... keywords)[Sizes]) {
+    return static_string_automaton_states(__static_string_detail::make(keywords) ...);
+}
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_string_automaton_classes(const Char (& ... keywords)[Sizes]) {
+    return static_string_automaton_classes(__static_string_detail::make(keywords) ...);
+}
+
+namespace __static_string_detail {
+
+template<typename Builder>
+struct builder_symbol_less {
+    constexpr bool operator()(size_t index1, size_t index2) const {
+        return compare(builder.data + builder.offsets[index1], builder.lengths[index1],
+            builder.data + builder.offsets[index2], builder.lengths[index2]) < 0;
+    }
+    const Builder& builder;
+};
+
+// position of ch in the ascending symbols plus one, 0 for the characters that do not occur
+template<typename Char>
+constexpr size_t symbol_class(const Char* symbols, size_t count, Char ch) {
+    size_t low = 0, high = count;
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if (symbol_value(symbols[middle]) < symbol_value(ch))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low < count && symbols[low] == ch ? low + 1 : 0;
+}
+
+// sorts the keys by symbol value into order and collects the symbols, returns their number
+template<typename Builder, typename Char>
+constexpr size_t prepare_trie(const Builder& builder, size_t count, size_t* order, Char* symbols, size_t capacity) {
+    for (size_t i = 0; i < count; ++i)
+        order[i] = i;
+    heap_sort(order, count, builder_symbol_less<Builder>{builder});
+    for (size_t i = 1; i < count; ++i)
+        if (!builder_symbol_less<Builder>{builder}(order[i - 1], order[i]))
+            throw std::invalid_argument("static_string_trie: duplicate key");
+    return automaton_symbols(builder, symbols, capacity);
+}
+
+struct trie_node {
+    size_t slot;
+    size_t first;
+    size_t last;
+    size_t depth;
+};
+
+// free slots form a linked list so that the base search skips the occupied ones
+template<size_t Capacity>
+struct trie_workspace {
+    constexpr void use(size_t slot) {
+        used[slot] = true;
+        next_free[previous_free[slot]] = next_free[slot];
+        if (next_free[slot] < Capacity)
+            previous_free[next_free[slot]] = previous_free[slot];
+    }
+    bool used[Capacity];
+    size_t next_free[Capacity];
+    size_t previous_free[Capacity];
+    size_t classes[Capacity];
+    size_t firsts[Capacity];
+    trie_node queue[Capacity];
+};
+
+// double array in breadth-first order: the child of the node in slot s for class c is in slot
+// base[s] + c when check[base[s] + c] == s, the root is slot 1; the sorted keys below a node are
+// the ranks [lower[s], upper[s]) and terminals[s] is the key ending there or count;
+// bases are the first fit over the free slots, returns the number of slots needed;
+// with null arrays only the slots are counted
+template<typename Builder, typename Char, typename Index, typename Rank, size_t Capacity>
+constexpr size_t build_trie(const Builder& builder, size_t count, const size_t* order, const Char* symbols, size_t symbol_count,
+    Index* base, Index* check, Rank* lower, Rank* upper, Rank* terminals, trie_workspace<Capacity>& workspace) {
+    for (size_t i = 0; i < Capacity; ++i) {
+        workspace.next_free[i] = i + 1;
+        workspace.previous_free[i] = i > 0 ? i - 1 : 0;
+    }
+    workspace.use(1);
+    size_t size = 2, head = 0, tail = 0;
+    workspace.queue[tail++] = {1, 0, count, 0};
+    while (head < tail) {
+        const trie_node node = workspace.queue[head++];
+        size_t first = node.first;
+        if (first < node.last && builder.lengths[order[first]] == node.depth)
+            ++first;
+        if (base != nullptr) {
+            lower[node.slot] = static_cast<Rank>(node.first);
+            upper[node.slot] = static_cast<Rank>(node.last);
+            terminals[node.slot] = static_cast<Rank>(first > node.first ? order[node.first] : count);
+        }
+        size_t children = 0;
+        for (size_t i = first; i < node.last; ++i) {
+            const Char ch = builder.data[builder.offsets[order[i]] + node.depth];
+            if (i == first || ch != builder.data[builder.offsets[order[i - 1]] + node.depth]) {
+                workspace.classes[children] = symbol_class(symbols, symbol_count, ch);
+                workspace.firsts[children++] = i;
+            }
+        }
+        if (children == 0)
+            continue;
+        workspace.firsts[children] = node.last;
+        size_t offset = 0;
+        for (size_t free = workspace.next_free[0]; ; free = workspace.next_free[free]) {
+            if (free >= Capacity)
+                throw std::length_error("static_string_trie: too many slots");
+            if (free <= workspace.classes[0])
+                continue;
+            offset = free - workspace.classes[0];
+            bool fits = true;
+            for (size_t k = 1; k < children && fits; ++k) {
+                if (offset + workspace.classes[k] >= Capacity)
+                    throw std::length_error("static_string_trie: too many slots");
+                fits = !workspace.used[offset + workspace.classes[k]];
+            }
+            if (fits)
+                break;
+        }
+        if (base != nullptr)
+            base[node.slot] = static_cast<Index>(offset);
+        for (size_t k = 0; k < children; ++k) {
+            const size_t slot = offset + workspace.classes[k];
+            workspace.use(slot);
+            if (base != nullptr)
+                check[slot] = static_cast<Index>(node.slot);
+            workspace.queue[tail++] = {slot, workspace.firsts[k], workspace.firsts[k + 1], node.depth + 1};
+        }
+        if (offset + symbol_count + 1 > size)
+            size = offset + symbol_count + 1;
+    }
+    return size;
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Count, size_t Length, size_t Size, size_t Classes> struct basic_static_string_trie {
+    using index_type = typename std::conditional<Size <= 0xFFFF, std::uint16_t, std::uint32_t>::type;
+    using rank_type = typename std::conditional<Count < 0xFFFF, std::uint16_t, std::uint32_t>::type;
+    using class_type = typename std::conditional<Classes <= 0xFF, std::uint8_t, std::uint32_t>::type;
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    constexpr size_t size() const {
+        return Count;
+    }
+    constexpr size_t capacity() const {
+        return Size;
+    }
+    constexpr size_t classes() const {
+        return Classes;
+    }
+    constexpr size_t length(size_t index) const {
+        return lengths[index];
+    }
+    constexpr const Char* c_str(size_t index) const {
+        return keys + offsets[index];
+    }
+    constexpr const Char* operator[](size_t index) const {
+        return keys + offsets[index];
+    }
+    // class 0 stands for every character that does not occur in the keys
+    constexpr size_t class_of(Char ch) const {
+        return __static_string_detail::symbol_value(ch) < 256 ? byte_classes[__static_string_detail::symbol_value(ch)] :
+            __static_string_detail::symbol_class(symbols + 1, Classes - 1, ch);
+    }
+    // a missing child fails the check, class 0 included: no slot is the child of its parent's base
+    constexpr size_t next(size_t slot, Char ch) const {
+        const size_t target = base[slot] + class_of(ch);
+        return check[target] == slot ? target : 0;
+    }
+    constexpr size_t index(const Char* key, size_t length) const {
+        size_t slot = 1;
+        for (size_t i = 0; i < length && slot != 0; ++i)
+            slot = next(slot, key[i]);
+        return slot != 0 && terminals[slot] != Count ? terminals[slot] : npos;
+    }
+    constexpr bool contains(const Char* key, size_t length) const {
+        return index(key, length) != npos;
+    }
+    // the longest key that str starts with, its length is length(index)
+    constexpr size_t longest_prefix(const Char* str, size_t length) const {
+        size_t slot = 1, result = terminals[1];
+        for (size_t i = 0; i < length; ++i) {
+            slot = next(slot, str[i]);
+            if (slot == 0)
+                break;
+            if (terminals[slot] != Count)
+                result = terminals[slot];
+        }
+        return result != Count ? result : npos;
+    }
+    // calls callback(index) for every key that starts with prefix in ascending order of
+    // character values, returns the number of these keys
+    template<typename Callback> size_t enumerate(const Char* prefix, size_t length, Callback&& callback) const {
+        size_t slot = 1;
+        for (size_t i = 0; i < length && slot != 0; ++i)
+            slot = next(slot, prefix[i]);
+        if (slot == 0)
+            return 0;
+        for (size_t rank = lower[slot]; rank < upper[slot]; ++rank)
+            callback(static_cast<size_t>(order[rank]));
+        return static_cast<size_t>(upper[slot] - lower[slot]);
+    }
+    template<typename Traits, typename Alloc> size_t index(const std::basic_string<Char, Traits, Alloc>& key) const {
+        return index(key.data(), key.size());
+    }
+    template<typename Traits, typename Alloc> bool contains(const std::basic_string<Char, Traits, Alloc>& key) const {
+        return contains(key.data(), key.size());
+    }
+    template<typename Traits, typename Alloc> size_t longest_prefix(const std::basic_string<Char, Traits, Alloc>& str) const {
+        return longest_prefix(str.data(), str.size());
+    }
+    template<typename Traits, typename Alloc, typename Callback>
+    size_t enumerate(const std::basic_string<Char, Traits, Alloc>& prefix, Callback&& callback) const {
+        return enumerate(prefix.data(), prefix.size(), std::forward<Callback>(callback));
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    constexpr std::basic_string_view<Char> view(size_t index) const {
+        return std::basic_string_view<Char>(keys + offsets[index], lengths[index]);
+    }
+    constexpr size_t index(std::basic_string_view<Char> key) const {
+        return index(key.data(), key.size());
+    }
+    constexpr bool contains(std::basic_string_view<Char> key) const {
+        return contains(key.data(), key.size());
+    }
+    constexpr size_t longest_prefix(std::basic_string_view<Char> str) const {
+        return longest_prefix(str.data(), str.size());
+    }
+    template<typename Callback> size_t enumerate(std::basic_string_view<Char> prefix, Callback&& callback) const {
+        return enumerate(prefix.data(), prefix.size(), std::forward<Callback>(callback));
+    }
+#endif
+    index_type base[Size];
+    index_type check[Size];
+    rank_type lower[Size];
+    rank_type upper[Size];
+    rank_type terminals[Size];
+    rank_type order[Count > 0 ? Count : 1];
+    Char keys[Length > 0 ? Length : 1];
+    size_t offsets[Count > 0 ? Count : 1];
+    size_t lengths[Count > 0 ? Count : 1];
+    class_type byte_classes[256];
+    Char symbols[Classes];
+};
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_string_trie_size(const basic_static_string<Char, Sizes>& ... keys) {
+    constexpr size_t count = sizeof ... (Sizes);
+    constexpr size_t length = __static_string_detail::sum({(Sizes - 1) ...});
+    // first fit keeps the double array close to the number of nodes, at most length + 1
+    constexpr size_t capacity = 3 * length + 4;
+    const auto builder = __static_string_detail::make_static_string_table_builder(keys ...);
+    size_t order[count > 0 ? count : 1]{};
+    Char symbols[length + 1]{};
+    const size_t symbol_count = __static_string_detail::prepare_trie(builder, count, order, symbols, length + 1);
+    __static_string_detail::trie_workspace<capacity> workspace{};
+    return __static_string_detail::build_trie<decltype(builder), Char, size_t, size_t>(builder, count, order, symbols, symbol_count,
+        nullptr, nullptr, nullptr, nullptr, nullptr, workspace);
+}
+
+template<size_t Size, size_t Classes, typename Char, size_t ... Sizes>
+constexpr basic_static_string_trie<Char, sizeof ... (Sizes), __static_string_detail::sum({Sizes ...}), Size, Classes>
+make_static_string_trie(const basic_static_string<Char, Sizes>& ... keys) {
+    constexpr size_t count = sizeof ... (Sizes);
+    const auto builder = __static_string_detail::make_static_string_table_builder(keys ...);
+    basic_static_string_trie<Char, count, __static_string_detail::sum({Sizes ...}), Size, Classes> trie{};
+    size_t order[count > 0 ? count : 1]{};
+    const size_t symbol_count = __static_string_detail::prepare_trie(builder, count, order, trie.symbols + 1, Classes - 1);
+    for (size_t i = 1; i <= symbol_count; ++i)
+        if (__static_string_detail::symbol_value(trie.symbols[i]) < 256)
+            trie.byte_classes[__static_string_detail::symbol_value(trie.symbols[i])] = i;
+    __static_string_detail::trie_workspace<Size> workspace{};
+    __static_string_detail::build_trie(builder, count, order, trie.symbols + 1, symbol_count,
+        trie.base, trie.check, trie.lower, trie.upper, trie.terminals, workspace);
+    for (size_t rank = 0, offset = 0; rank < count; ++rank) {
+        trie.order[rank] = order[rank];
+        trie.offsets[rank] = offset;
+        trie.lengths[rank] = builder.lengths[rank];
+        for (size_t i = 0; i < builder.lengths[rank]; ++i)
+            trie.keys[offset + i] = builder.data[builder.offsets[rank] + i];
+        offset += builder.lengths[rank] + 1;
+    }
+    return trie;
+}
+
+template<size_t Size, size_t Classes, typename Char, size_t ... Sizes>
+constexpr auto make_static_string_trie(const Char (& ... keys)[Sizes]) {
+    return make_static_string_trie<Size, Classes>(__static_string_detail::make(keys) ...);
+}
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_string_trie_size(const Char (& ... keys)[Sizes]) {
+    return static_string_trie_size(__static_string_detail::make(keys) ...);
+}
+
+struct static_regex_span {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    constexpr bool matched() const {
+        return begin != npos;
+    }
+    constexpr size_t length() const {
+        return end - begin;
+    }
+    size_t begin;
+    size_t end;
+};
+
+namespace __static_string_detail {
+
+enum regex_node_kind : unsigned char {
+    regex_class,
+    regex_split,
+    regex_jump,
+    regex_save,
+    regex_match
+};
+
+// a class node moves on next1 for the characters in mask, split and jump nodes
+// are epsilon moves, a save node stores the position into capture slot next2
+struct regex_node {
+    unsigned char kind;
+    size_t next1;
+    size_t next2;
+    unsigned long long mask[4];
+};
+
+template<typename Symbol>
+struct regex_range {
+    Symbol low;
+    Symbol high;
+};
+
+struct regex_fragment {
+    size_t start;
+    size_t exit;
+    bool second;
+};
+
+// Thompson construction for regular expressions (| * + ? () (?:) . [] [^] \d \w \s ^ $) and globs
+// (* ? [] [!] \), followed by splitting the alphabet into classes of characters that no character set
+// in the pattern tells apart; ^ and $ read two marker classes past the alphabet, which the matcher
+// feeds at the ends of the input, and the pattern is wrapped in ^* and $* loops to ignore them
+template<typename Char, size_t Size>
+struct regex_compiler {
+    using symbol_type = typename std::make_unsigned<Char>::type;
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    static constexpr size_t max_nodes = 3 * Size + 8;
+    static constexpr size_t max_ranges = 2 * Size + 2;
+    static constexpr size_t max_classes = 256;
+    static constexpr symbol_type max_symbol = std::numeric_limits<symbol_type>::max();
+
+    constexpr bool at(char ch) const {
+        return position < length && pattern[position] == static_cast<Char>(ch);
+    }
+    constexpr size_t add(unsigned char kind, size_t next1 = npos, size_t next2 = npos) {
+        if (node_count == max_nodes)
+            throw std::logic_error("static_regex: too many nodes");
+        nodes[node_count] = regex_node{kind, next1, next2, {0, 0, 0, 0}};
+        range_begin[node_count] = range_end[node_count] = range_count;
+        negate[node_count] = false;
+        anchor[node_count] = 0;
+        return node_count++;
+    }
+    constexpr void add_range(symbol_type low, symbol_type high) {
+        if (range_count == max_ranges)
+            throw std::logic_error("static_regex: too many character ranges");
+        ranges[range_count++] = regex_range<symbol_type>{low, high};
+    }
+    constexpr void patch(const regex_fragment& fragment, size_t target) {
+        if (fragment.second)
+            nodes[fragment.exit].next2 = target;
+        else
+            nodes[fragment.exit].next1 = target;
+    }
+    constexpr regex_fragment close(size_t node) {
+        range_end[node] = range_count;
+        return {node, node, false};
+    }
+    constexpr regex_fragment literal(Char ch) {
+        const size_t node = add(regex_class);
+        add_range(static_cast<symbol_type>(ch), static_cast<symbol_type>(ch));
+        return close(node);
+    }
+    constexpr regex_fragment any() {
+        const size_t node = add(regex_class);
+        add_range(0, max_symbol);
+        return close(node);
+    }
+    // 1 for ^ and 2 for $
+    constexpr regex_fragment marker(unsigned char which) {
+        const size_t node = add(regex_class);
+        anchor[node] = which;
+        anchors = true;
+        return close(node);
+    }
+    // escaped punctuation stands for itself, letters and digits other than these are
+    // reserved for escapes like \b or \1 that the DFA cannot express
+    static constexpr Char control(Char ch) {
+        if ((ch >= static_cast<Char>('0') && ch <= static_cast<Char>('9')) || (ch >= static_cast<Char>('A') && ch <= static_cast<Char>('Z')) ||
+            (ch >= static_cast<Char>('a') && ch <= static_cast<Char>('z') && ch != static_cast<Char>('n') && ch != static_cast<Char>('t') &&
+            ch != static_cast<Char>('r') && ch != static_cast<Char>('f') && ch != static_cast<Char>('v')))
+            throw std::invalid_argument("static_regex: unsupported escape");
+        return ch == static_cast<Char>('n') ? static_cast<Char>('\n') : ch == static_cast<Char>('t') ? static_cast<Char>('\t') :
+            ch == static_cast<Char>('r') ? static_cast<Char>('\r') : ch == static_cast<Char>('f') ? static_cast<Char>('\f') :
+            ch == static_cast<Char>('v') ? static_cast<Char>('\v') : ch;
+    }
+    // adds the ranges of \d, \w or \s, returns false for other escapes
+    constexpr bool add_escape_class(Char ch) {
+        const Char lower = ch >= static_cast<Char>('A') && ch <= static_cast<Char>('Z') ? ch - static_cast<Char>('A') + static_cast<Char>('a') : ch;
+        if (lower == static_cast<Char>('d') || lower == static_cast<Char>('w'))
+            add_range(static_cast<symbol_type>('0'), static_cast<symbol_type>('9'));
+        if (lower == static_cast<Char>('w')) {
+            add_range(static_cast<symbol_type>('A'), static_cast<symbol_type>('Z'));
+            add_range(static_cast<symbol_type>('_'), static_cast<symbol_type>('_'));
+            add_range(static_cast<symbol_type>('a'), static_cast<symbol_type>('z'));
+        }
+        if (lower == static_cast<Char>('s')) {
+            add_range(static_cast<symbol_type>('\t'), static_cast<symbol_type>('\r'));
+            add_range(static_cast<symbol_type>(' '), static_cast<symbol_type>(' '));
+        }
+        return lower == static_cast<Char>('d') || lower == static_cast<Char>('w') || lower == static_cast<Char>('s');
+    }
+    constexpr regex_fragment parse_bracket() {
+        const size_t node = add(regex_class);
+        if (at('^') || (glob && at('!'))) {
+            negate[node] = true;
+            ++position;
+        }
+        for (bool first = true; position < length && (first || !at(']')); first = false) {
+            Char low = pattern[position++];
+            if (low == static_cast<Char>('\\') && position < length) {
+                low = pattern[position++];
+                if (!glob && add_escape_class(low)) {
+                    if (low < static_cast<Char>('a'))
+                        throw std::invalid_argument("static_regex: negated class escape inside brackets");
+                    continue;
+                }
+                low = glob ? low : control(low);
+            }
+            Char high = low;
+            if (at('-') && position + 1 < length && pattern[position + 1] != static_cast<Char>(']')) {
+                ++position;
+                high = pattern[position++];
+                if (high == static_cast<Char>('\\') && position < length)
+                    high = glob ? pattern[position++] : control(pattern[position++]);
+                if (static_cast<symbol_type>(high) < static_cast<symbol_type>(low))
+                    throw std::invalid_argument("static_regex: invalid character range");
+            }
+            add_range(static_cast<symbol_type>(low), static_cast<symbol_type>(high));
+        }
+        if (!at(']'))
+            throw std::invalid_argument("static_regex: missing ']'");
+        ++position;
+        return close(node);
+    }
+    constexpr regex_fragment parse_atom() {
+        const Char ch = pattern[position++];
+        if (glob) {
+            if (ch == static_cast<Char>('*')) {
+                const regex_fragment any_char = any();
+                const size_t split = add(regex_split, any_char.start);
+                patch(any_char, split);
+                return {split, split, true};
+            }
+            if (ch == static_cast<Char>('?'))
+                return any();
+            if (ch == static_cast<Char>('['))
+                return parse_bracket();
+            return literal(ch == static_cast<Char>('\\') && position < length ? pattern[position++] : ch);
+        }
+        if (ch == static_cast<Char>('(')) {
+            const bool capture = !(at('?') && position + 1 < length && pattern[position + 1] == static_cast<Char>(':'));
+            position += capture ? 0 : 2;
+            const size_t group = capture ? ++groups : 0;
+            const regex_fragment inner = parse_alternation();
+            if (!at(')'))
+                throw std::invalid_argument("static_regex: missing ')'");
+            ++position;
+            if (!capture)
+                return inner;
+            const size_t open = add(regex_save, inner.start, 2 * group);
+            const size_t close_group = add(regex_save, npos, 2 * group + 1);
+            patch(inner, close_group);
+            return {open, close_group, false};
+        }
+        if (ch == static_cast<Char>('.'))
+            return any();
+        if (ch == static_cast<Char>('['))
+            return parse_bracket();
+        if (ch == static_cast<Char>('\\')) {
+            if (position == length)
+                throw std::invalid_argument("static_regex: trailing '\\'");
+            const Char escaped = pattern[position++];
+            const size_t node = add(regex_class);
+            if (add_escape_class(escaped)) {
+                negate[node] = escaped < static_cast<Char>('a');
+                return close(node);
+            }
+            const Char value = control(escaped);
+            add_range(static_cast<symbol_type>(value), static_cast<symbol_type>(value));
+            return close(node);
+        }
+        if (ch == static_cast<Char>('*') || ch == static_cast<Char>('+') || ch == static_cast<Char>('?'))
+            throw std::invalid_argument("static_regex: nothing to repeat");
+        if (ch == static_cast<Char>('{'))
+            throw std::invalid_argument("static_regex: counted repetition is not supported");
+        if (ch == static_cast<Char>('^') || ch == static_cast<Char>('$'))
+            return marker(ch == static_cast<Char>('^') ? 1 : 2);
+        return literal(ch);
+    }
+    constexpr regex_fragment parse_repeat() {
+        regex_fragment fragment = parse_atom();
+        for (; !glob && position < length; ++position) {
+            if (at('*')) {
+                const size_t split = add(regex_split, fragment.start);
+                patch(fragment, split);
+                fragment = {split, split, true};
+            } else if (at('+')) {
+                const size_t split = add(regex_split, fragment.start);
+                patch(fragment, split);
+                fragment = {fragment.start, split, true};
+            } else if (at('?')) {
+                const size_t split = add(regex_split, fragment.start);
+                const size_t join = add(regex_jump);
+                patch(fragment, join);
+                nodes[split].next2 = join;
+                fragment = {split, join, false};
+            } else if (at('{')) {
+                throw std::invalid_argument("static_regex: counted repetition is not supported");
+            } else {
+                break;
+            }
+        }
+        return fragment;
+    }
+    constexpr regex_fragment parse_concat() {
+        regex_fragment result{npos, npos, false};
+        while (position < length && (glob || (!at('|') && !at(')')))) {
+            const regex_fragment fragment = parse_repeat();
+            if (result.start == npos) {
+                result = fragment;
+            } else {
+                patch(result, fragment.start);
+                result.exit = fragment.exit;
+                result.second = fragment.second;
+            }
+        }
+        if (result.start == npos) {
+            const size_t jump = add(regex_jump);
+            result = {jump, jump, false};
+        }
+        return result;
+    }
+    constexpr regex_fragment parse_alternation() {
+        regex_fragment left = parse_concat();
+        while (!glob && at('|')) {
+            ++position;
+            const regex_fragment right = parse_concat();
+            const size_t split = add(regex_split, left.start, right.start);
+            const size_t join = add(regex_jump);
+            patch(left, join);
+            patch(right, join);
+            left = {split, join, false};
+        }
+        return left;
+    }
+    // classes of characters, then the ^ and $ markers when the pattern has anchors
+    constexpr size_t classes() const {
+        return boundary_count + 1 + (anchors ? 2 : 0);
+    }
+    constexpr void compile() {
+        const regex_fragment fragment = parse_alternation();
+        if (position != length)
+            throw std::invalid_argument("static_regex: unmatched ')'");
+        start = add(regex_save, fragment.start, 0);
+        const size_t end = add(regex_save, npos, 1);
+        patch(fragment, end);
+        match = add(regex_match);
+        nodes[end].next1 = match;
+        if (anchors) {
+            const size_t begin_loop = add(regex_split, marker(1).start, start);
+            nodes[begin_loop - 1].next1 = start = begin_loop;
+            const size_t end_loop = add(regex_split, marker(2).start, match);
+            nodes[end_loop - 1].next1 = nodes[end].next1 = end_loop;
+        }
+        // class boundaries: every range starts a class and ends one
+        for (size_t i = 0; i < range_count; ++i) {
+            if (ranges[i].low > 0)
+                add_boundary(ranges[i].low);
+            if (ranges[i].high < max_symbol)
+                add_boundary(ranges[i].high + 1);
+        }
+        if (classes() > max_classes)
+            throw std::logic_error("static_regex: too many character classes");
+        for (size_t node = 0; node < node_count; ++node) {
+            if (nodes[node].kind != regex_class)
+                continue;
+            if (anchor[node] != 0) {
+                const size_t c = boundary_count + anchor[node];
+                nodes[node].mask[c / 64] |= 1ULL << (c % 64);
+                continue;
+            }
+            for (size_t c = 0; c <= boundary_count; ++c) {
+                const symbol_type symbol = c == 0 ? 0 : boundaries[c - 1];
+                bool contains = false;
+                for (size_t i = range_begin[node]; i < range_end[node]; ++i)
+                    contains = contains || (ranges[i].low <= symbol && symbol <= ranges[i].high);
+                if (contains != negate[node])
+                    nodes[node].mask[c / 64] |= 1ULL << (c % 64);
+            }
+        }
+    }
+    constexpr void add_boundary(symbol_type symbol) {
+        size_t i = boundary_count;
+        for (; i > 0 && boundaries[i - 1] > symbol; --i) {}
+        if (i > 0 && boundaries[i - 1] == symbol)
+            return;
+        for (size_t j = boundary_count; j > i; --j)
+            boundaries[j] = boundaries[j - 1];
+        boundaries[i] = symbol;
+        ++boundary_count;
+    }
+    constexpr size_t class_of(symbol_type symbol) const {
+        size_t result = 0;
+        for (; result < boundary_count && boundaries[result] <= symbol; ++result) {}
+        return result;
+    }
+
+    Char pattern[Size];
+    size_t length;
+    size_t position;
+    bool glob;
+    bool anchors;
+    size_t groups;
+    size_t start;
+    size_t match;
+    regex_node nodes[max_nodes];
+    size_t range_begin[max_nodes];
+    size_t range_end[max_nodes];
+    bool negate[max_nodes];
+    unsigned char anchor[max_nodes];
+    size_t node_count;
+    regex_range<symbol_type> ranges[max_ranges];
+    size_t range_count;
+    symbol_type boundaries[2 * max_ranges];
+    size_t boundary_count;
+};
+
+template<typename Char, size_t Size>
+constexpr regex_compiler<Char, Size> compile_regex(const basic_static_string<Char, Size>& pattern, bool glob) {
+    regex_compiler<Char, Size> compiler{};
+    for (size_t i = 0; i < Size; ++i)
+        compiler.pattern[i] = pattern.data[i];
+    compiler.length = Size - 1;
+    compiler.glob = glob;
+    compiler.compile();
+    return compiler;
+}
+
+// subset construction followed by Moore's partition refinement; state 0 is the empty set, state 1
+// the start of the pattern and state 2 the start of the reversed pattern with .* at its front, whose
+// sets hold the nodes that reach the match over what has been read backwards, tagged by a node past the last
+template<typename Char, size_t Size, size_t Classes>
+struct regex_dfa_builder {
+    static constexpr size_t max_nodes = regex_compiler<Char, Size>::max_nodes;
+    static constexpr size_t words = (max_nodes + 64) / 64;
+    static constexpr size_t reversed = max_nodes;
+    static constexpr size_t max_states = 4 * max_nodes + 64;
+
+    static constexpr bool has(const unsigned long long* set, size_t node) {
+        return (set[node / 64] >> (node % 64) & 1) != 0;
+    }
+    static constexpr void insert(unsigned long long* set, size_t node) {
+        set[node / 64] |= 1ULL << (node % 64);
+    }
+    // epsilon closure of every single node, a set's closure is the union of its members' closures
+    constexpr void close_nodes(const regex_compiler<Char, Size>& nfa) {
+        size_t stack[max_nodes]{};
+        for (size_t start = 0; start < nfa.node_count; ++start) {
+            unsigned long long* set = closures[start];
+            size_t top = 0;
+            insert(set, start);
+            stack[top++] = start;
+            while (top > 0) {
+                const regex_node& node = nfa.nodes[stack[--top]];
+                if (node.kind == regex_class || node.kind == regex_match)
+                    continue;
+                if (!has(set, node.next1)) {
+                    insert(set, node.next1);
+                    stack[top++] = node.next1;
+                }
+                if (node.kind == regex_split && !has(set, node.next2)) {
+                    insert(set, node.next2);
+                    stack[top++] = node.next2;
+                }
+            }
+        }
+        for (size_t from = 0; from < nfa.node_count; ++from)
+            for (size_t to = 0; to < nfa.node_count; ++to)
+                if (has(closures[from], to))
+                    insert(reverse_closures[to], from);
+    }
+    constexpr size_t find(const unsigned long long* set) const {
+        for (size_t state = 0; state < count; ++state) {
+            bool equal = true;
+            for (size_t i = 0; i < words && equal; ++i)
+                equal = sets[state][i] == set[i];
+            if (equal)
+                return state;
+        }
+        return max_states;
+    }
+    constexpr void build(const regex_compiler<Char, Size>& nfa) {
+        if (nfa.classes() != Classes)
+            throw std::invalid_argument("static_regex: number of classes does not match pattern");
+        close_nodes(nfa);
+        count = 3;
+        for (size_t i = 0; i < words; ++i) {
+            sets[1][i] = closures[nfa.start][i];
+            sets[2][i] = reverse_closures[nfa.match][i];
+        }
+        insert(sets[2], reversed);
+        for (size_t state = 1; state < count; ++state) {
+            const bool backwards = has(sets[state], reversed);
+            accepting[state] = has(sets[state], backwards ? nfa.start : nfa.match);
+            size_t moves[max_nodes]{};
+            size_t move_count = 0;
+            for (size_t node = 0; node < nfa.node_count; ++node)
+                if (nfa.nodes[node].kind == regex_class && has(sets[state], backwards ? nfa.nodes[node].next1 : node))
+                    moves[move_count++] = node;
+            for (size_t c = 0; c < Classes; ++c) {
+                unsigned long long next[words]{};
+                for (size_t j = 0; backwards && j < words; ++j)
+                    next[j] = sets[2][j];
+                for (size_t i = 0; i < move_count; ++i)
+                    if ((nfa.nodes[moves[i]].mask[c / 64] >> (c % 64) & 1) != 0)
+                        for (size_t j = 0; j < words; ++j)
+                            next[j] |= backwards ? reverse_closures[moves[i]][j] : closures[nfa.nodes[moves[i]].next1][j];
+                size_t target = find(next);
+                if (target == max_states) {
+                    if (count == max_states)
+                        throw std::logic_error("static_regex: too many DFA states");
+                    for (size_t i = 0; i < words; ++i)
+                        sets[count][i] = next[i];
+                    target = count++;
+                }
+                transitions[state * Classes + c] = target;
+            }
+        }
+        bool any_accepting = false;
+        for (size_t state = 0; state < count; ++state) {
+            blocks[state] = accepting[state] ? 1 : 0;
+            any_accepting = any_accepting || accepting[state];
+        }
+        block_count = any_accepting ? 2 : 1;
+        for (;;) {
+            size_t next_blocks[max_states]{};
+            size_t next_count = 0;
+            for (size_t state = 0; state < count; ++state) {
+                size_t same = 0;
+                for (; same < state; ++same) {
+                    bool equal = blocks[same] == blocks[state];
+                    for (size_t c = 0; c < Classes && equal; ++c)
+                        equal = blocks[transitions[same * Classes + c]] == blocks[transitions[state * Classes + c]];
+                    if (equal)
+                        break;
+                }
+                next_blocks[state] = same < state ? next_blocks[same] : next_count++;
+            }
+            for (size_t state = 0; state < count; ++state)
+                blocks[state] = next_blocks[state];
+            if (next_count == block_count)
+                break;
+            block_count = next_count;
+        }
+    }
+
+    unsigned long long closures[max_nodes][words];
+    unsigned long long reverse_closures[max_nodes][words];
+    unsigned long long sets[max_states][words];
+    size_t transitions[max_states * Classes];
+    bool accepting[max_states];
+    size_t blocks[max_states];
+    size_t count;
+    size_t block_count;
+};
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Size, size_t Classes, size_t States, size_t Groups> struct basic_static_regex {
+    using state_type = typename std::conditional<States <= 0xFFFF, std::uint16_t, std::uint32_t>::type;
+    using class_type = typename std::conditional<Classes <= 0xFF, std::uint8_t, std::uint16_t>::type;
+    using symbol_type = typename std::make_unsigned<Char>::type;
+    using captures_type = std::array<static_regex_span, Groups + 1>;
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    static constexpr size_t max_nodes = __static_string_detail::regex_compiler<Char, Size>::max_nodes;
+    constexpr size_t states() const {
+        return States;
+    }
+    constexpr size_t classes() const {
+        return Classes;
+    }
+    constexpr size_t groups() const {
+        return Groups;
+    }
+    constexpr size_t class_of(Char ch) const {
+        const symbol_type symbol = static_cast<symbol_type>(ch);
+        if (symbol < 256)
+            return byte_classes[symbol];
+        size_t low = 0, high = begin_class - 1;
+        while (low < high) {
+            const size_t middle = low + (high - low) / 2;
+            if (boundaries[middle] <= symbol)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return low;
+    }
+    // reads the ^ (begin_class) or $ (begin_class + 1) marker at an end of the input until the state
+    // stops changing, so that any number of anchors hold there; the sets of NFA nodes only grow on the
+    // way thanks to the ^* and $* loops, and so does acceptance, the bound is for cycles between them
+    constexpr size_t skip_marker(size_t state, size_t marker) const {
+        for (size_t i = 0; i < States && dfa[state * Classes + marker] != state; ++i)
+            state = dfa[state * Classes + marker];
+        return state;
+    }
+    // whole input must match
+    constexpr bool match(const Char* str, size_t length) const {
+        size_t state = anchors ? skip_marker(start, begin_class) : start;
+        for (size_t i = 0; i < length && state != 0; ++i)
+            state = dfa[state * Classes + class_of(str[i])];
+        return accepting[anchors ? skip_marker(state, begin_class + 1) : state];
+    }
+    // leftmost-longest match at or after from in O(length): the reversed DFA read from the end accepts
+    // at every position where a match starts, the forward one finds the longest match from the leftmost
+    constexpr static_regex_span search(const Char* str, size_t length, size_t from = 0) const {
+        if (from > length)
+            return {npos, npos};
+        size_t state = anchors ? skip_marker(reverse_start, begin_class + 1) : reverse_start;
+        size_t begin = accepting[state] ? length : npos;
+        for (size_t i = length; i > from; --i) {
+            state = dfa[state * Classes + class_of(str[i - 1])];
+            if (accepting[state])
+                begin = i - 1;
+        }
+        if (anchors && from == 0 && accepting[skip_marker(state, begin_class)])
+            begin = 0;
+        if (begin == npos)
+            return {npos, npos};
+        state = anchors && begin == 0 ? skip_marker(start, begin_class) : start;
+        size_t end = npos;
+        for (size_t i = begin; state != 0; ++i) {
+            if (accepting[state] || (anchors && i == length && accepting[skip_marker(state, begin_class + 1)]))
+                end = i;
+            if (i == length)
+                break;
+            state = dfa[state * Classes + class_of(str[i])];
+        }
+        return {begin, end};
+    }
+    bool match(const Char* str, size_t length, captures_type& captures) const {
+        if (!match(str, length))
+            return false;
+        extract(str, 0, length, length, captures);
+        return true;
+    }
+    static_regex_span search(const Char* str, size_t length, captures_type& captures, size_t from = 0) const {
+        const static_regex_span span = search(str, length, from);
+        if (span.matched())
+            extract(str, span.begin, span.end, length, captures);
+        return span;
+    }
+    template<typename Str> constexpr auto match(const Str& str) const -> decltype(__static_string_detail::make_ref<Char>(str), bool()) {
+        return match(__static_string_detail::make_ref<Char>(str).data, __static_string_detail::make_ref<Char>(str).size);
+    }
+    template<typename Str> auto match(const Str& str, captures_type& captures) const
+        -> decltype(__static_string_detail::make_ref<Char>(str), bool()) {
+        const auto ref = __static_string_detail::make_ref<Char>(str);
+        return match(ref.data, ref.size, captures);
+    }
+    template<typename Str> constexpr auto search(const Str& str, size_t from = 0) const
+        -> decltype(__static_string_detail::make_ref<Char>(str), static_regex_span()) {
+        return search(__static_string_detail::make_ref<Char>(str).data, __static_string_detail::make_ref<Char>(str).size, from);
+    }
+    template<typename Str> auto search(const Str& str, captures_type& captures, size_t from = 0) const
+        -> decltype(__static_string_detail::make_ref<Char>(str), static_regex_span()) {
+        const auto ref = __static_string_detail::make_ref<Char>(str);
+        return search(ref.data, ref.size, captures, from);
+    }
+
+    using slots_type = std::array<size_t, 2 * (Groups + 1)>;
+    struct thread_list {
+        size_t count;
+        size_t nodes[max_nodes];
+        slots_type slots[max_nodes];
+        size_t marks[max_nodes];
+    };
+    static constexpr bool has_class(const __static_string_detail::regex_node& node, size_t c) {
+        return (node.mask[c / 64] >> (c % 64) & 1) != 0;
+    }
+    // the ^ and $ markers are assertions here rather than symbols
+    void add_thread(thread_list& list, size_t index, slots_type slots, size_t position, size_t length, size_t generation) const {
+        if (list.marks[index] == generation)
+            return;
+        list.marks[index] = generation;
+        const __static_string_detail::regex_node& node = nodes[index];
+        if (node.kind == __static_string_detail::regex_jump) {
+            add_thread(list, node.next1, slots, position, length, generation);
+        } else if (node.kind == __static_string_detail::regex_split) {
+            add_thread(list, node.next1, slots, position, length, generation);
+            add_thread(list, node.next2, slots, position, length, generation);
+        } else if (node.kind == __static_string_detail::regex_save) {
+            slots[node.next2] = position;
+            add_thread(list, node.next1, slots, position, length, generation);
+        } else if (anchors && node.kind == __static_string_detail::regex_class &&
+            (has_class(node, begin_class) || has_class(node, begin_class + 1))) {
+            if (position == (has_class(node, begin_class) ? 0 : length))
+                add_thread(list, node.next1, slots, position, length, generation);
+        } else {
+            list.nodes[list.count] = index;
+            list.slots[list.count++] = slots;
+        }
+    }
+    // the DFA has found the span, a Pike VM over the NFA recovers the groups with
+    // the usual leftmost-first priorities for a match of exactly that span
+    void extract(const Char* str, size_t begin, size_t end, size_t length, captures_type& captures) const {
+        thread_list lists[2];
+        lists[0].count = lists[1].count = 0;
+        for (size_t i = 0; i < max_nodes; ++i)
+            lists[0].marks[i] = lists[1].marks[i] = 0;
+        slots_type slots{};
+        slots.fill(std::numeric_limits<size_t>::max());
+        size_t generation = 1;
+        add_thread(lists[0], node_start, slots, begin, length, generation);
+        size_t current = 0;
+        for (size_t position = begin; position < end; ++position, current ^= 1) {
+            const size_t c = class_of(str[position]);
+            thread_list& next = lists[current ^ 1];
+            next.count = 0;
+            ++generation;
+            for (size_t i = 0; i < lists[current].count; ++i) {
+                const __static_string_detail::regex_node& node = nodes[lists[current].nodes[i]];
+                if (node.kind == __static_string_detail::regex_class && has_class(node, c))
+                    add_thread(next, node.next1, lists[current].slots[i], position + 1, length, generation);
+            }
+        }
+        for (size_t i = 0; i < lists[current].count; ++i) {
+            if (nodes[lists[current].nodes[i]].kind == __static_string_detail::regex_match) {
+                for (size_t group = 0; group <= Groups; ++group)
+                    captures[group] = static_regex_span{lists[current].slots[i][2 * group], lists[current].slots[i][2 * group + 1]};
+                return;
+            }
+        }
+    }
+
+    state_type dfa[States * Classes];
+    bool accepting[States];
+    size_t start;
+    size_t reverse_start;
+    bool anchors;
+    size_t begin_class; // the first class past the characters, the ^ marker when there are anchors
+    symbol_type boundaries[Classes];
+    class_type byte_classes[256];
+    __static_string_detail::regex_node nodes[max_nodes];
+    size_t node_start;
+};
+
+namespace __static_string_detail {
+
+template<size_t Classes, size_t States, size_t Groups, typename Char, size_t Size>
+constexpr basic_static_regex<Char, Size, Classes, States, Groups> make_static_regex(const basic_static_string<Char, Size>& pattern, bool glob) {
+    const auto nfa = compile_regex(pattern, glob);
+    if (nfa.groups != Groups)
+        throw std::invalid_argument("static_regex: number of groups does not match pattern");
+    regex_dfa_builder<Char, Size, Classes> builder{};
+    builder.build(nfa);
+    if (builder.block_count != States)
+        throw std::invalid_argument("static_regex: number of states does not match pattern");
+    basic_static_regex<Char, Size, Classes, States, Groups> regex{};
+    for (size_t state = 0; state < builder.count; ++state) {
+        regex.accepting[builder.blocks[state]] = builder.accepting[state];
+        for (size_t c = 0; c < Classes; ++c)
+            regex.dfa[builder.blocks[state] * Classes + c] = builder.blocks[builder.transitions[state * Classes + c]];
+    }
+    regex.start = builder.blocks[1];
+    regex.reverse_start = builder.blocks[2];
+    regex.anchors = nfa.anchors;
+    regex.begin_class = nfa.boundary_count + 1;
+    for (size_t i = 0; i < nfa.boundary_count; ++i)
+        regex.boundaries[i] = nfa.boundaries[i];
+    for (size_t i = 0; i < 256; ++i)
+        regex.byte_classes[i] = nfa.class_of(i);
+    for (size_t i = 0; i < nfa.node_count; ++i)
+        regex.nodes[i] = nfa.nodes[i];
+    regex.node_start = nfa.start;
+    return regex;
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Size>
+constexpr size_t static_regex_classes(const basic_static_string<Char, Size>& pattern, bool glob = false) {
+    return __static_string_detail::compile_regex(pattern, glob).classes();
+}
+
+template<typename Char, size_t Size>
+constexpr size_t static_regex_classes(const Char (& pattern)[Size], bool glob = false) {
+    return static_regex_classes(__static_string_detail::make(pattern), glob);
+}
+
+template<size_t Classes, typename Char, size_t Size>
+constexpr size_t static_regex_states(const basic_static_string<Char, Size>& pattern, bool glob = false) {
+    __static_string_detail::regex_dfa_builder<Char, Size, Classes> builder{};
+    builder.build(__static_string_detail::compile_regex(pattern, glob));
+    return builder.block_count;
+}
+
+template<size_t Classes, typename Char, size_t Size>
+constexpr size_t static_regex_states(const Char (& pattern)[Size], bool glob = false) {
+    return static_regex_states<Classes>(__static_string_detail::make(pattern), glob);
+}
+
+template<typename Char, size_t Size>
+constexpr size_t static_regex_groups(const basic_static_string<Char, Size>& pattern, bool glob = false) {
+    return __static_string_detail::compile_regex(pattern, glob).groups;
+}
+
+template<typename Char, size_t Size>
+constexpr size_t static_regex_groups(const Char (& pattern)[Size], bool glob = false) {
+    return static_regex_groups(__static_string_detail::make(pattern), glob);
+}
+
+template<size_t Classes, size_t States, size_t Groups, typename Char, size_t Size>
+constexpr auto make_static_regex(const basic_static_string<Char, Size>& pattern) {
+    return __static_string_detail::make_static_regex<Classes, States, Groups>(pattern, false);
+}
+
+template<size_t Classes, size_t States, size_t Groups, typename Char, size_t Size>
+constexpr auto make_static_regex(const Char (& pattern)[Size]) {
+    return __static_string_detail::make_static_regex<Classes, States, Groups>(__static_string_detail::make(pattern), false);
+}
+
+template<size_t Classes, size_t States, typename Char, size_t Size>
+constexpr auto make_static_glob(const basic_static_string<Char, Size>& pattern) {
+    return __static_string_detail::make_static_regex<Classes, States, 0>(pattern, true);
+}
+
+template<size_t Classes, size_t States, typename Char, size_t Size>
+constexpr auto make_static_glob(const Char (& pattern)[Size]) {
+    return __static_string_detail::make_static_regex<Classes, States, 0>(__static_string_detail::make(pattern), true);
+}
+
+template<typename Char> struct basic_static_config_value {
+    constexpr size_t size() const {
+        return length;
+    }
+    constexpr bool empty() const {
+        return length == 0;
+    }
+    constexpr Char operator[](size_t index) const {
+        return data[index];
+    }
+    constexpr bool equals(const Char* str, size_t size) const {
+        if (size != length)
+            return false;
+        for (size_t i = 0; i < size; ++i)
+            if (data[i] != str[i])
+                return false;
+        return true;
+    }
+    template<size_t Size> constexpr bool operator==(const basic_static_string<Char, Size>& str) const {
+        return equals(&str.data[0], Size - 1);
+    }
+    template<size_t Size> constexpr bool operator==(const Char (& str)[Size]) const {
+        return equals(str, Size - 1);
+    }
+    template<typename Str> constexpr bool operator!=(const Str& str) const {
+        return !(*this == str);
+    }
+    std::basic_string<Char> str() const {
+        return std::basic_string<Char>(data, length);
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    constexpr std::basic_string_view<Char> view() const {
+        return std::basic_string_view<Char>(data, length);
+    }
+#endif
+    const Char* data;
+    size_t length;
+};
+
+namespace __static_string_detail {
+
+struct static_config_entry {
+    size_t section;
+    size_t section_length;
+    size_t key;
+    size_t key_length;
+    size_t value;
+    size_t value_length;
+};
+
+template<typename Char>
+constexpr bool is_config_space(Char ch) {
+    return ch == static_cast<Char>(' ') || ch == static_cast<Char>('\t') || ch == static_cast<Char>('\r');
+}
+
+template<typename Char>
+constexpr bool is_config_separator(Char ch) {
+    return ch == static_cast<Char>(';') || ch == static_cast<Char>('\n');
+}
+
+// key = value entries separated by ';' or new lines, [section] headers, # comments
+// and "quoted" values that may contain separators; returns the number of entries
+template<typename Char>
+constexpr size_t parse_config(const Char* text, size_t length, static_config_entry* entries, size_t capacity) {
+    size_t count = 0, section = 0, section_length = 0;
+    for (size_t position = 0; position < length;) {
+        while (position < length && (is_config_space(text[position]) || is_config_separator(text[position])))
+            ++position;
+        if (position == length)
+            break;
+        if (text[position] == static_cast<Char>('#')) {
+            while (position < length && text[position] != static_cast<Char>('\n'))
+                ++position;
+            continue;
+        }
+        if (text[position] == static_cast<Char>('[')) {
+            section = ++position;
+            while (position < length && text[position] != static_cast<Char>(']') && !is_config_separator(text[position]))
+                ++position;
+            if (position == length || text[position] != static_cast<Char>(']'))
+                throw std::invalid_argument("static_config: missing ']'");
+            section_length = position++ - section;
+            while (section_length > 0 && is_config_space(text[section]))
+                ++section, --section_length;
+            while (section_length > 0 && is_config_space(text[section + section_length - 1]))
+                --section_length;
+            continue;
+        }
+        static_config_entry entry{section, section_length, position, 0, 0, 0};
+        while (position < length && text[position] != static_cast<Char>('=') && !is_config_separator(text[position]))
+            ++position;
+        if (position == length || text[position] != static_cast<Char>('='))
+            throw std::invalid_argument("static_config: missing '='");
+        entry.key_length = position++ - entry.key;
+        while (entry.key_length > 0 && is_config_space(text[entry.key + entry.key_length - 1]))
+            --entry.key_length;
+        if (entry.key_length == 0)
+            throw std::invalid_argument("static_config: empty key");
+        while (position < length && is_config_space(text[position]))
+            ++position;
+        if (position < length && text[position] == static_cast<Char>('"')) {
+            entry.value = ++position;
+            while (position < length && text[position] != static_cast<Char>('"'))
+                ++position;
+            if (position == length)
+                throw std::invalid_argument("static_config: missing '\"'");
+            entry.value_length = position++ - entry.value;
+            while (position < length && is_config_space(text[position]))
+                ++position;
+            if (position < length && !is_config_separator(text[position]))
+                throw std::invalid_argument("static_config: characters after quoted value");
+        } else {
+            entry.value = position;
+            while (position < length && !is_config_separator(text[position]))
+                ++position;
+            entry.value_length = position - entry.value;
+            while (entry.value_length > 0 && is_config_space(text[entry.value + entry.value_length - 1]))
+                --entry.value_length;
+        }
+        for (size_t i = 0; entries != nullptr && i < count; ++i)
+            if (entries[i].section_length == entry.section_length && entries[i].key_length == entry.key_length &&
+                equal(text + entries[i].section, text + entry.section, entry.section_length) &&
+                equal(text + entries[i].key, text + entry.key, entry.key_length))
+                throw std::invalid_argument("static_config: duplicate key");
+        if (entries != nullptr) {
+            if (count == capacity)
+                throw std::length_error("static_config: too many entries");
+            entries[count] = entry;
+        }
+        ++count;
+    }
+    return count;
+}
+
+template<typename Char>
+constexpr bool parse_config_bool(const Char* str, size_t length) {
+    const basic_static_config_value<Char> value{str, length};
+    if (value == "true" || value == "yes" || value == "on" || value == "1")
+        return true;
+    if (value == "false" || value == "no" || value == "off" || value == "0")
+        return false;
+    throw std::invalid_argument("static_config: not a boolean");
+}
+
+template<typename T, typename Char>
+constexpr T parse_config_number(const Char* str, size_t length) {
+    const parse_result<T> result = parse_number<T>(str, length, 10);
+    return result.error == parse_error::out_of_range ? throw std::out_of_range("static_config: value out of range") :
+        result.error != parse_error::none ? throw std::invalid_argument("static_config: not a number") : result.value;
+}
+
+template<typename T, typename Char, typename Enable = void>
+struct config_value_parser;
+
+template<typename T, typename Char>
+struct config_value_parser<T, Char, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type> {
+    static constexpr T parse(const Char* str, size_t length) {
+        return parse_config_number<T>(str, length);
+    }
+};
+
+template<typename Char>
+struct config_value_parser<bool, Char> {
+    static constexpr bool parse(const Char* str, size_t length) {
+        return parse_config_bool(str, length);
+    }
+};
+
+template<typename T, typename Char>
+struct config_value_parser<T, Char, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static constexpr T parse(const Char* str, size_t length) {
+        return parse_config_number<T>(str, length);
+    }
+};
+
+template<typename Char>
+struct config_value_parser<basic_static_config_value<Char>, Char> {
+    static constexpr basic_static_config_value<Char> parse(const Char* str, size_t length) {
+        return {str, length};
+    }
+};
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Size, size_t Count> struct basic_static_config {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    constexpr size_t size() const {
+        return Count;
+    }
+    constexpr basic_static_config_value<Char> section(size_t index) const {
+        return {text + entries[index].section, entries[index].section_length};
+    }
+    constexpr basic_static_config_value<Char> key(size_t index) const {
+        return {text + entries[index].key, entries[index].key_length};
+    }
+    constexpr basic_static_config_value<Char> value(size_t index) const {
+        return {text + entries[index].value, entries[index].value_length};
+    }
+    // name is "key" for entries before the first section and "section.key" after it
+    constexpr size_t index(const Char* name, size_t length) const {
+        for (size_t i = 0; i < Count; ++i) {
+            const __static_string_detail::static_config_entry& entry = entries[i];
+            const size_t prefix = entry.section_length > 0 ? entry.section_length + 1 : 0;
+            if (length == prefix + entry.key_length &&
+                __static_string_detail::equal(text + entry.section, name, entry.section_length) &&
+                (prefix == 0 || name[entry.section_length] == static_cast<Char>('.')) &&
+                __static_string_detail::equal(text + entry.key, name + prefix, entry.key_length))
+                return i;
+        }
+        return npos;
+    }
+    template<size_t NameSize> constexpr size_t index(const Char (& name)[NameSize]) const {
+        return index(name, NameSize - 1);
+    }
+    template<size_t NameSize> constexpr size_t index(const basic_static_string<Char, NameSize>& name) const {
+        return index(&name.data[0], NameSize - 1);
+    }
+    template<typename Name> constexpr bool contains(const Name& name) const {
+        return index(name) != npos;
+    }
+    template<typename T, typename Name> constexpr T get(const Name& name) const {
+        return index(name) == npos ? throw std::out_of_range("static_config: no such key") :
+            __static_string_detail::config_value_parser<T, Char>::parse(text + entries[index(name)].value, entries[index(name)].value_length);
+    }
+    template<typename T, typename Name> constexpr T get(const Name& name, T fallback) const {
+        return index(name) == npos ? fallback : get<T>(name);
+    }
+    template<typename Name> constexpr basic_static_config_value<Char> get_string(const Name& name) const {
+        return get<basic_static_config_value<Char>>(name);
+    }
+    template<typename ... Ts, typename ... Names> constexpr std::tuple<Ts ...> get_tuple(const Names& ... names) const {
+        static_assert(sizeof ... (Ts) == sizeof ... (Names), "number of types does not match number of names");
+        return std::tuple<Ts ...>(get<Ts>(names) ...);
+    }
+    Char text[Size];
+    __static_string_detail::static_config_entry entries[Count > 0 ? Count : 1];
+};
+
+template<typename Char, size_t Size>
+constexpr size_t static_config_size(const basic_static_string<Char, Size>& text) {
+    return __static_string_detail::parse_config<Char>(&text.data[0], Size - 1, nullptr, 0);
+}
+
+template<typename Char, size_t Size>
+constexpr size_t static_config_size(const Char (& text)[Size]) {
+    return __static_string_detail::parse_config<Char>(text, Size - 1, nullptr, 0);
+}
+
+template<size_t Count, typename Char, size_t Size>
+constexpr basic_static_config<Char, Size, Count> make_static_config(const basic_static_string<Char, Size>& text) {
+    basic_static_config<Char, Size, Count> config{};
+    for (size_t i = 0; i < Size; ++i)
+        config.text[i] = text.data[i];
+    if (__static_string_detail::parse_config<Char>(config.text, Size - 1, config.entries, Count) != Count)
+        throw std::invalid_argument("static_config: number of entries does not match text");
+    return config;
+}
+
+template<size_t Count, typename Char, size_t Size>
+constexpr basic_static_config<Char, Size, Count> make_static_config(const Char (& text)[Size]) {
+    return make_static_config<Count>(__static_string_detail::make(text));
+}
+
+namespace __static_string_detail {
+
+// char and char8_t hold UTF-8, char16_t UTF-16, char32_t UTF-32 and wchar_t whichever its size fits
+template<typename Char>
+using utf_width = std::integral_constant<size_t, sizeof(Char) == 1 ? 8 : sizeof(Char) == 2 ? 16 : 32>;
+
+constexpr bool is_code_point(char32_t code) {
+    return code <= 0x10FFFF && (code < 0xD800 || code > 0xDFFF);
+}
+
+template<typename Char>
+constexpr char32_t decode_utf(const Char* str, size_t length, size_t& i, std::integral_constant<size_t, 8>) {
+    const char32_t lead = static_cast<unsigned char>(str[i++]);
+    if (lead < 0x80)
+        return lead;
+    const size_t trail = lead >= 0xC2 && lead <= 0xDF ? 1 : lead >= 0xE0 && lead <= 0xEF ? 2 : lead >= 0xF0 && lead <= 0xF4 ? 3 : 0;
+    if (trail == 0)
+        throw std::invalid_argument("invalid UTF-8 lead byte");
+    char32_t code = lead & (0x3F >> trail);
+    for (size_t j = 0; j < trail; ++j, ++i) {
+        if (i == length || (static_cast<unsigned char>(str[i]) & 0xC0) != 0x80)
+            throw std::invalid_argument("truncated UTF-8 sequence");
+        code = code << 6 | (static_cast<unsigned char>(str[i]) & 0x3F);
+    }
+    if ((trail == 2 && code < 0x800) || (trail == 3 && code < 0x10000) || !is_code_point(code))
+        throw std::invalid_argument("overlong UTF-8 sequence, surrogate or code point above U+10FFFF");
+    return code;
+}
+
+template<typename Char>
+constexpr char32_t decode_utf(const Char* str, size_t length, size_t& i, std::integral_constant<size_t, 16>) {
+    const char32_t lead = static_cast<char16_t>(str[i++]);
+    if (lead < 0xD800 || lead > 0xDFFF)
+        return lead;
+    if (lead > 0xDBFF || i == length || static_cast<char16_t>(str[i]) < 0xDC00 || static_cast<char16_t>(str[i]) > 0xDFFF)
+        throw std::invalid_argument("unpaired UTF-16 surrogate");
+    return 0x10000 + ((lead - 0xD800) << 10) + (static_cast<char16_t>(str[i++]) - 0xDC00);
+}
+
+template<typename Char>
+constexpr char32_t decode_utf(const Char* str, size_t, size_t& i, std::integral_constant<size_t, 32>) {
+    const char32_t code = static_cast<char32_t>(str[i++]);
+    if (!is_code_point(code))
+        throw std::invalid_argument("surrogate or code point above U+10FFFF in UTF-32");
+    return code;
+}
+
+// writes the code units of code to out unless it is null and returns their number
+template<typename Char>
+constexpr size_t encode_utf(char32_t code, Char* out, std::integral_constant<size_t, 8>) {
+    const size_t size = code < 0x80 ? 1 : code < 0x800 ? 2 : code < 0x10000 ? 3 : 4;
+    if (out != nullptr) {
+        out[0] = static_cast<Char>(size == 1 ? code : (0xF00 >> size & 0xFF) | code >> (6 * (size - 1)));
+        for (size_t j = 1; j < size; ++j)
+            out[j] = static_cast<Char>(0x80 | (code >> (6 * (size - 1 - j)) & 0x3F));
+    }
+    return size;
+}
+
+template<typename Char>
+constexpr size_t encode_utf(char32_t code, Char* out, std::integral_constant<size_t, 16>) {
+    if (code < 0x10000) {
+        if (out != nullptr)
+            out[0] = static_cast<Char>(code);
+        return 1;
+    }
+    if (out != nullptr) {
+        out[0] = static_cast<Char>(0xD800 + ((code - 0x10000) >> 10));
+        out[1] = static_cast<Char>(0xDC00 + ((code - 0x10000) & 0x3FF));
+    }
+    return 2;
+}
+
+template<typename Char>
+constexpr size_t encode_utf(char32_t code, Char* out, std::integral_constant<size_t, 32>) {
+    if (out != nullptr)
+        out[0] = static_cast<Char>(code);
+    return 1;
+}
+
+template<typename Out, typename Char>
+constexpr size_t transcode(const Char* str, size_t length, Out* out) {
+    size_t size = 0;
+    for (size_t i = 0; i < length;)
+        size += encode_utf(decode_utf(str, length, i, utf_width<Char>{}), out != nullptr ? out + size : out, utf_width<Out>{});
+    return size;
+}
+
+template<typename Char, size_t Capacity> struct utf_buffer {
+    Char data[Capacity];
+};
+
+template<typename Out, size_t Length, typename Char, size_t Size, size_t ... Indexes>
+constexpr basic_static_string<Out, Length + 1> transcode(const basic_static_string<Char, Size>& str, index_sequence<Indexes ...>) {
+    utf_buffer<Out, Length + 1> buffer{};
+    if (transcode(&str.data[0], Size - 1, buffer.data) != Length)
+        throw std::invalid_argument("length does not match string");
+    return {buffer.data[Indexes] ..., static_cast<Out>('\0')};
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Size>
+constexpr size_t utf8_length(const basic_static_string<Char, Size>& str) {
+    return __static_string_detail::transcode<char>(&str.data[0], Size - 1, static_cast<char*>(nullptr));
+}
+
+template<typename Char, size_t Size>
+constexpr size_t utf8_length(const Char (& str)[Size]) {
+    return utf8_length(__static_string_detail::make(str));
+}
+
+template<typename Char, size_t Size>
+constexpr size_t utf16_length(const basic_static_string<Char, Size>& str) {
+    return __static_string_detail::transcode<char16_t>(&str.data[0], Size - 1, static_cast<char16_t*>(nullptr));
+}
+
+template<typename Char, size_t Size>
+constexpr size_t utf16_length(const Char (& str)[Size]) {
+    return utf16_length(__static_string_detail::make(str));
+}
+
+template<typename Char, size_t Size>
+constexpr size_t utf32_length(const basic_static_string<Char, Size>& str) {
+    return __static_string_detail::transcode<char32_t>(&str.data[0], Size - 1, static_cast<char32_t*>(nullptr));
+}
+
+template<typename Char, size_t Size>
+constexpr size_t utf32_length(const Char (& str)[Size]) {
+    return utf32_length(__static_string_detail::make(str));
+}
+
+template<size_t Length, typename Out = char, typename Char, size_t Size>
+constexpr basic_static_string<Out, Length + 1> to_utf8(const basic_static_string<Char, Size>& str) {
+    static_assert(sizeof(Out) == 1, "UTF-8 needs a one byte character type");
+    return __static_string_detail::transcode<Out, Length>(str, __static_string_detail::make_index_sequence<Length>{});
+}
+
+template<size_t Length, typename Out = char, typename Char, size_t Size>
+constexpr basic_static_string<Out, Length + 1> to_utf8(const Char (& str)[Size]) {
+    return to_utf8<Length, Out>(__static_string_detail::make(str));
+}
+
+template<size_t Length, typename Out = char16_t, typename Char, size_t Size>
+constexpr basic_static_string<Out, Length + 1> to_utf16(const basic_static_string<Char, Size>& str) {
+    static_assert(sizeof(Out) == 2, "UTF-16 needs a two byte character type");
+    return __static_string_detail::transcode<Out, Length>(str, __static_string_detail::make_index_sequence<Length>{});
+}
+
+template<size_t Length, typename Out = char16_t, typename Char, size_t Size>
+constexpr basic_static_string<Out, Length + 1> to_utf16(const Char (& str)[Size]) {
+    return to_utf16<Length, Out>(__static_string_detail::make(str));
+}
+
+template<size_t Length, typename Out = char32_t, typename Char, size_t Size>
+constexpr basic_static_string<Out, Length + 1> to_utf32(const basic_static_string<Char, Size>& str) {
+    static_assert(sizeof(Out) == 4, "UTF-32 needs a four byte character type");
+    return __static_string_detail::transcode<Out, Length>(str, __static_string_detail::make_index_sequence<Length>{});
+}
+
+template<size_t Length, typename Out = char32_t, typename Char, size_t Size>
+constexpr basic_static_string<Out, Length + 1> to_utf32(const Char (& str)[Size]) {
+    return to_utf32<Length, Out>(__static_string_detail::make(str));
+}
+
+template<typename Char>
+using basic_static_route_param = basic_static_config_value<Char>;
+
+template<typename Char, size_t MaxParams> struct basic_static_route_match {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    explicit constexpr operator bool() const {
+        return route != npos;
+    }
+    constexpr size_t size() const {
+        return count;
+    }
+    constexpr const basic_static_route_param<Char>& operator[](size_t index) const {
+        return params[index];
+    }
+    template<typename T> parse_result<T> parse(size_t index, int radix = 10) const {
+        return snw1::parse<T>(params[index].data, params[index].data + params[index].length, radix);
+    }
+    size_t route;
+    size_t count;
+    basic_static_route_param<Char> params[MaxParams > 0 ? MaxParams : 1];
+};
+
+using static_route_param = basic_static_route_param<char>;
+template<size_t MaxParams>
+using static_route_match = basic_static_route_match<char, MaxParams>;
+
+namespace __static_string_detail {
+
+enum router_node_kind : unsigned char {
+    router_literal,
+    router_int,
+    router_string,
+    router_path
+};
+
+// children of a node are a sibling list ordered by kind, so literal segments are tried
+// before {name:int}, {name} and {name:path} captures
+struct static_router_node {
+    size_t offset;
+    size_t length;
+    unsigned char kind;
+    size_t child;
+    size_t sibling;
+    size_t route;
+};
+
+template<typename Char>
+constexpr bool equal_text(const Char* str, size_t length, const char* text) {
+    size_t i = 0;
+    for (; i < length && text[i] != '\0'; ++i)
+        if (str[i] != static_cast<Char>(text[i]))
+            return false;
+    return i == length && text[i] == '\0';
+}
+
+// pattern: '/' segment ('/' segment)*, a segment is literal text or a whole {name}, {name:int},
+// {name:str} or a final {name:path} capture; returns the kind and sets name_length
+template<typename Char>
+constexpr unsigned char router_segment(const Char* pattern, size_t begin, size_t end, size_t length, size_t& name_length) {
+    name_length = 0;
+    if (begin == end || pattern[begin] != static_cast<Char>('{')) {
+        for (size_t i = begin; i < end; ++i)
+            if (pattern[i] == static_cast<Char>('{') || pattern[i] == static_cast<Char>('}'))
+                throw std::invalid_argument("static_router: capture must be a whole segment");
+        return router_literal;
+    }
+    if (pattern[end - 1] != static_cast<Char>('}'))
+        throw std::invalid_argument("static_router: capture must be a whole segment");
+    for (; begin + 1 + name_length < end - 1 && pattern[begin + 1 + name_length] != static_cast<Char>(':'); ++name_length)
+        if (pattern[begin + 1 + name_length] == static_cast<Char>('{') || pattern[begin + 1 + name_length] == static_cast<Char>('}'))
+            throw std::invalid_argument("static_router: capture must be a whole segment");
+    if (name_length == 0)
+        throw std::invalid_argument("static_router: empty capture name");
+    const size_t type = begin + 1 + name_length;
+    if (type == end - 1 || equal_text(pattern + type + 1, end - type - 2, "str"))
+        return router_string;
+    if (equal_text(pattern + type + 1, end - type - 2, "int"))
+        return router_int;
+    if (equal_text(pattern + type + 1, end - type - 2, "path")) {
+        if (end != length)
+            throw std::invalid_argument("static_router: path capture must be the last segment");
+        return router_path;
+    }
+    throw std::invalid_argument("static_router: unknown capture type");
+}
+
+// merges the segments of all patterns into one tree rooted at node 0, returns the number of nodes
+template<typename Char, typename Builder>
+constexpr size_t build_router(const Builder& builder, size_t count, static_router_node* nodes, size_t capacity) {
+    constexpr size_t npos = std::numeric_limits<size_t>::max();
+    nodes[0] = {0, 0, router_literal, npos, npos, npos};
+    size_t size = 1;
+    for (size_t route = 0; route < count; ++route) {
+        const Char* pattern = builder.data + builder.offsets[route];
+        const size_t length = builder.lengths[route];
+        if (length == 0 || pattern[0] != static_cast<Char>('/'))
+            throw std::invalid_argument("static_router: pattern must start with '/'");
+        size_t node = 0;
+        for (size_t begin = 1, end = 1; begin <= length; begin = end + 1) {
+            for (end = begin; end < length && pattern[end] != static_cast<Char>('/'); ++end) {}
+            size_t name_length = 0;
+            const unsigned char kind = router_segment(pattern, begin, end, length, name_length);
+            size_t* link = &nodes[node].child;
+            for (; *link != npos && nodes[*link].kind < kind; link = &nodes[*link].sibling) {}
+            for (; *link != npos && nodes[*link].kind == kind; link = &nodes[*link].sibling)
+                if (kind != router_literal || (nodes[*link].length == end - begin &&
+                    equal(builder.data + nodes[*link].offset, pattern + begin, end - begin)))
+                    break;
+            if (*link == npos || nodes[*link].kind != kind) {
+                if (size == capacity)
+                    throw std::length_error("static_router: too many nodes");
+                nodes[size] = {builder.offsets[route] + begin, end - begin, kind, npos, *link, npos};
+                *link = size++;
+            }
+            node = *link;
+        }
+        if (nodes[node].route != npos)
+            throw std::invalid_argument("static_router: duplicate route");
+        nodes[node].route = route;
+    }
+    return size;
+}
+
+// matches the segment at begin against the children of node and the rest of path below them,
+// backtracking to the next sibling when a subtree fails; returns the route or Router::npos
+template<typename Router, typename Char>
+size_t match_route(const Router& router, size_t node, const Char* path, size_t length, size_t begin,
+    basic_static_route_param<Char>* params, size_t& count) {
+    const Char* separator = std::char_traits<Char>::find(path + begin, length - begin, static_cast<Char>('/'));
+    const size_t end = separator != nullptr ? static_cast<size_t>(separator - path) : length;
+    const size_t captured = count;
+    for (size_t child = router.nodes[node].child; child != Router::npos; child = router.nodes[child].sibling) {
+        const static_router_node& current = router.nodes[child];
+        count = captured;
+        if (current.kind == router_literal) {
+            if (current.length != end - begin ||
+                std::char_traits<Char>::compare(router.patterns + current.offset, path + begin, end - begin) != 0)
+                continue;
+        } else if (current.kind == router_path) {
+            if (begin == length)
+                continue;
+            params[count++] = {path + begin, length - begin};
+            return current.route;
+        } else {
+            if (begin == end)
+                continue;
+            if (current.kind == router_int) {
+                size_t i = begin;
+                for (; i < end && path[i] >= static_cast<Char>('0') && path[i] <= static_cast<Char>('9'); ++i) {}
+                if (i != end)
+                    continue;
+            }
+            params[count++] = {path + begin, end - begin};
+        }
+        const size_t route = end == length ? current.route : match_route(router, child, path, length, end + 1, params, count);
+        if (route != Router::npos)
+            return route;
+    }
+    count = captured;
+    return Router::npos;
+}
+
+template<typename Char>
+constexpr size_t router_params(const Char* pattern, size_t length) {
+    size_t params = 0;
+    for (size_t i = 0; i < length; ++i)
+        params += pattern[i] == static_cast<Char>('{');
+    return params;
+}
+
+} // namespace __static_string_detail
+
+template<typename Char, size_t Count, size_t Length, size_t Nodes, size_t MaxParams> struct basic_static_router {
+    using match_type = basic_static_route_match<Char, MaxParams>;
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    constexpr size_t size() const {
+        return Count;
+    }
+    constexpr const Char* pattern(size_t route) const {
+        return patterns + offsets[route];
+    }
+    constexpr size_t length(size_t route) const {
+        return lengths[route];
+    }
+    // position of the capture called name among the captures of route, npos if there is none
+    template<size_t Size> constexpr size_t param_index(size_t route, const Char (& name)[Size]) const {
+        size_t index = 0;
+        for (size_t i = 0; i < lengths[route]; ++i) {
+            if (patterns[offsets[route] + i] != static_cast<Char>('{'))
+                continue;
+            size_t j = 0;
+            for (; j < Size - 1 && i + 1 + j < lengths[route] && patterns[offsets[route] + i + 1 + j] == name[j]; ++j) {}
+            const Char next = i + 1 + j < lengths[route] ? patterns[offsets[route] + i + 1 + j] : static_cast<Char>('\0');
+            if (j == Size - 1 && (next == static_cast<Char>('}') || next == static_cast<Char>(':')))
+                return index;
+            ++index;
+        }
+        return npos;
+    }
+    // the path without the query string; segments are matched depth first with literal
+    // segments first, so "/users/new" wins over "/users/{id}" and the captures point into path
+    match_type match(const Char* path, size_t length) const {
+        match_type result{npos, 0, {}};
+        if (length > 0 && path[0] == static_cast<Char>('/'))
+            result.route = __static_string_detail::match_route(*this, 0, path, length, 1, result.params, result.count);
+        return result;
+    }
+    template<typename Traits, typename Alloc> match_type match(const std::basic_string<Char, Traits, Alloc>& path) const {
+        return match(path.data(), path.size());
+    }
+    // calls the handler of the matching route with the match or fallback() when no route matches
+    template<typename Default, typename ... Handlers>
+    auto operator()(const Char* path, size_t length, Default&& fallback, Handlers&& ... handlers) const
+        -> decltype(fallback()) {
+        static_assert(sizeof ... (Handlers) == Count, "Number of handlers differs from number of routes");
+        using result = decltype(fallback());
+        const match_type found = match(path, length);
+        if (!found)
+            return static_cast<result>(fallback());
+        auto targets = std::forward_as_tuple(std::forward<Handlers>(handlers) ...);
+        return __static_string_detail::dispatch<result>(targets, found.route,
+            __static_string_detail::make_index_sequence<Count>{}, found);
+    }
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+    match_type match(std::basic_string_view<Char> path) const {
+        return match(path.data(), path.size());
+    }
+    template<typename Default, typename ... Handlers>
+    auto operator()(std::basic_string_view<Char> path, Default&& fallback, Handlers&& ... handlers) const
+        -> decltype(fallback()) {
+        return (*this)(path.data(), path.size(), std::forward<Default>(fallback), std::forward<Handlers>(handlers) ...);
+    }
+#endif
+    Char patterns[Length + 1];
+    size_t offsets[Count > 0 ? Count : 1];
+    size_t lengths[Count > 0 ? Count : 1];
+    __static_string_detail::static_router_node nodes[Nodes > 0 ? Nodes : 1];
+};
+
+template<size_t Count, size_t Length, size_t Nodes, size_t MaxParams>
+using static_router = basic_static_router<char, Count, Length, Nodes, MaxParams>;
+template<size_t Count, size_t Length, size_t Nodes, size_t MaxParams>
+using static_wrouter = basic_static_router<wchar_t, Count, Length, Nodes, MaxParams>;
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_router_nodes(const basic_static_string<Char, Sizes>& ... patterns) {
+    const auto builder = __static_string_detail::make_static_string_table_builder(patterns ...);
+    __static_string_detail::static_router_node nodes[__static_string_detail::sum({Sizes ...})]{};
+    return __static_string_detail::build_router<Char>(builder, sizeof ... (Sizes), nodes, __static_string_detail::sum({Sizes ...}));
+}
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_router_params(const basic_static_string<Char, Sizes>& ... patterns) {
+    return __static_string_detail::max({__static_string_detail::router_params(&patterns.data[0], Sizes - 1) ...});
+}
+
+template<size_t Nodes, size_t MaxParams, typename Char, size_t ... Sizes>
+constexpr basic_static_router<Char, sizeof ... (Sizes), __static_string_detail::sum({(Sizes - 1) ...}), Nodes, MaxParams>
+make_static_router(const basic_static_string<Char, Sizes>& ... patterns) {
+    constexpr size_t count = sizeof ... (Sizes);
+    const auto builder = __static_string_detail::make_static_string_table_builder(patterns ...);
+    basic_static_router<Char, count, __static_string_detail::sum({(Sizes - 1) ...}), Nodes, MaxParams> router{};
+    for (size_t i = 0; i < builder.offset; ++i)
+        router.patterns[i] = builder.data[i];
+    for (size_t i = 0; i < count; ++i) {
+        router.offsets[i] = builder.offsets[i];
+        router.lengths[i] = builder.lengths[i];
+    }
+    __static_string_detail::build_router<Char>(builder, count, router.nodes, Nodes);
+    return router;
+}
+
+template<size_t Nodes, size_t MaxParams, typename Char, size_t ... Sizes>
+constexpr auto make_static_router(const Char (& ... patterns)[Sizes]) {
+    return make_static_router<Nodes, MaxParams>(__static_string_detail::make(patterns) ...);
+}
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_router_nodes(const Char (& ... patterns)[Sizes]) {
+    return static_router_nodes(__static_string_detail::make(patterns) ...);
+}
+
+template<typename Char, size_t ... Sizes>
+constexpr size_t static_router_params(const Char (& ... patterns)[Sizes]) {
+    return static_router_params(__static_string_detail::make(patterns) ...);
+}
+
 } // namespace snw1
 
 #endif // SNW1_STATIC_STRING_H
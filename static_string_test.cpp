@@ -1,10 +1,91 @@
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <limits>
 #include <algorithm>
+#include <cstring>
+#include <cwchar>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+#include <vector>
 #include "static_string.h"
 
 using namespace snw1;
 
+// runtime checks that stay on in release builds, unlike assert()
+#define CHECK(...) ((__VA_ARGS__) ? static_cast<void>(0) : check_failed(#__VA_ARGS__, __FILE__, __LINE__))
+
+[[noreturn]] void check_failed(const char* expression, const char* file, int line) {
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    std::abort();
+}
+
+template<typename Char, size_t Size, size_t ... Lengths>
+void check_hash_prefixes(const basic_static_string<Char, Size>& str, std::index_sequence<Lengths ...>) {
+    const bool equal[] = {(str.template prefix<Lengths>().hash() == static_string_hash(&str.data[0], Lengths)) ...};
+    for (bool e : equal)
+        CHECK(e);
+}
+
+template<typename Algo, typename Char, size_t Size>
+void check_hash_algorithm(const basic_static_string<Char, Size>& str) {
+    for (unsigned long long key = 0; key < 4; ++key)
+        CHECK(str.template hash<Algo>(key, ~key) == static_string_hash<Algo>(&str.data[0], Size - 1, key, ~key));
+}
+
+template<typename Algo, typename Char, size_t Size, size_t ... Lengths>
+void check_hash_algorithm_prefixes(const basic_static_string<Char, Size>& str, std::index_sequence<Lengths ...>) {
+    int unused[] = {0, (check_hash_algorithm<Algo>(str.template prefix<Lengths>()), 0) ...};
+    static_cast<void>(unused);
+}
+
+template<typename T> struct counting_allocator {
+    using value_type = T;
+    counting_allocator(size_t& allocations) : allocations(&allocations) {}
+    template<typename U> counting_allocator(const counting_allocator<U>& other) : allocations(other.allocations) {}
+    T* allocate(size_t n) {
+        ++*allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T* p, size_t n) {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    template<typename U> bool operator==(const counting_allocator<U>& other) const {
+        return allocations == other.allocations;
+    }
+    template<typename U> bool operator!=(const counting_allocator<U>& other) const {
+        return allocations != other.allocations;
+    }
+    size_t* allocations;
+};
+
+template<typename Searcher>
+void check_searcher(const Searcher& searcher, const std::string& needle) {
+    unsigned long long seed = 88172645463325252ULL;
+    std::string haystack;
+    for (size_t length = 0; length < 300; ++length) {
+        for (size_t from = 0; from <= length + 1; from += 1 + length / 7) {
+            const size_t expected = haystack.find(needle, from);
+            CHECK(searcher.find(haystack.data(), haystack.size(), from) == (expected == std::string::npos ? searcher.npos : expected));
+        }
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        haystack += "ab"[seed % 2];
+    }
+}
+
+#ifdef SNW1_STATIC_STRING_HAS_CLASS_NTTP
+template<basic_static_string Name> struct metric {
+    static constexpr const auto& name = Name;
+};
+
+template<static_string_t Name> constexpr size_t field_width() {
+    return Name.size();
+}
+#endif
+
 int main() {
     { // make() simple tests
         constexpr char c[] = "abc";
@@ -617,6 +698,46 @@ int main() {
     static_assert(UTOSS(18446744073709551615ULL) == "18446744073709551615", "");
     static_assert(UTOSS(std::numeric_limits<unsigned long long>::max()) == "18446744073709551615", "");
 
+    // DTOSS() and FTOSS() tests
+    static_assert(DTOSS(0.0) == "0", "");
+    static_assert(DTOSS(-0.0) == "-0" && FTOSS(-0.0f, float_format::scientific) == "-0e+00", "");
+    static_assert(DTOSS(1.0) == "1", "");
+    static_assert(DTOSS(0.1) == "0.1", "");
+    static_assert(DTOSS(-2.5) == "-2.5", "");
+    static_assert(DTOSS(0.1 + 0.2) == "0.30000000000000004", "");
+    static_assert(DTOSS(123456.0) == "123456", "");
+    static_assert(DTOSS(0.001) == "0.001", "");
+    static_assert(DTOSS(1e-7) == "1e-07", "");
+    static_assert(DTOSS(1e22) == "1e+22", "");
+    static_assert(DTOSS(1e23, float_format::fixed) == "99999999999999991611392", "");
+    static_assert(DTOSS(9007199254740993.0) == "9007199254740992", "");
+    static_assert(DTOSS(5e-324) == "5e-324", "");
+    static_assert(DTOSS(2.2250738585072014e-308) == "2.2250738585072014e-308", "");
+    static_assert(DTOSS(std::numeric_limits<double>::max()) == "1.7976931348623157e+308", "");
+    static_assert(DTOSS(std::numeric_limits<double>::infinity()) == "inf", "");
+    static_assert(DTOSS(-std::numeric_limits<double>::infinity()) == "-inf", "");
+    static_assert(DTOSS(std::numeric_limits<double>::quiet_NaN()) == "nan", "");
+    static_assert(DTOSS(1500.0, float_format::scientific) == "1.5e+03", "");
+    static_assert(DTOSS(0.0, float_format::scientific) == "0e+00", "");
+    static_assert(DTOSS(1.25e-5, float_format::fixed) == "0.0000125", "");
+    static_assert(DTOSS(1e100, float_format::scientific) == "1e+100", "");
+    static_assert(DTOSS(5e-324, float_format::fixed).size() == 326, "");
+    static_assert(FTOSS(0.1f) == "0.1", "");
+    static_assert(FTOSS(3.14159f) == "3.14159", "");
+    static_assert(FTOSS(16777217.0f) == "16777216", "");
+    static_assert(FTOSS(std::numeric_limits<float>::max()) == "3.4028235e+38", "");
+    static_assert(FTOSS(std::numeric_limits<float>::denorm_min()) == "1e-45", "");
+    static_assert(FTOSS(1e10f, float_format::fixed) == "10000000000", "");
+    static_assert(DTOSW(-0.75) == L"-0.75", "");
+    static_assert(FTOSW(2.5e-3f, float_format::scientific) == L"2.5e-03", "");
+    static_assert(static_string::make("threshold=", DTOSS(0.95), "ms") == "threshold=0.95ms", "");
+    { // long double exponents can take four digits
+        const auto largest = __static_string_detail::format_float(std::numeric_limits<long double>::max(), float_format::general);
+        const std::string text(largest.text, largest.size);
+        CHECK(text.substr(text.find('e')) == "e+" + std::to_string(std::numeric_limits<long double>::max_exponent10));
+        CHECK(std::strtold(text.c_str(), nullptr) == std::numeric_limits<long double>::max());
+    }
+
     // SSTOI() tests
     static_assert(SSTOI("") == 0, "");
     static_assert(SSTOI("0") == 0, "");
@@ -676,6 +797,38 @@ int main() {
     static_assert(SSTOU("9223372036854775807") == 9223372036854775807ULL, "");
     static_assert(SSTOU("18446744073709551615") == 18446744073709551615ULL, "");
     static_assert(SSTOU("18446744073709551615") == std::numeric_limits<unsigned long long>::max(), "");
+    static_assert("873"_ss.to_uint() == 873 && "-873"_ss.to_int() == -873, "");
+
+    { // long string tests
+#define REPEAT10(x) x x x x x x x x x x
+        constexpr auto ls = REPEAT10(REPEAT10(REPEAT10("abc"))) ""_ss;
+#undef REPEAT10
+        static_assert(ls.size() == 3000, "");
+        static_assert(ls == ls, "");
+        static_assert(!(ls != ls), "");
+        static_assert(ls != ls.prefix<2999>(), "");
+        static_assert(ls > ls.prefix<2999>(), "");
+        static_assert(ls.count('a') == 1000, "");
+        static_assert(ls.find('c', 0, 999) == 2999, "");
+        static_assert(ls.find('d') == static_string::npos, "");
+        static_assert(ls.rfind('a') == 2997, "");
+        static_assert(ls.rfind('a', ls.rbegin(), 999) == 0, "");
+        static_assert(ls.find("cab", 0, 998) == 2996, "");
+        static_assert(ls.find("cba") == static_string::npos, "");
+        static_assert(ls.rfind("bca") == 2995, "");
+        static_assert(ls.hash() == 304531368383620013ULL, "");
+        static_assert(ls.starts_with(ls.prefix<2000>()), "");
+        static_assert(ls.ends_with(ls.suffix<1000>()), "");
+        static_assert(ls.substring<1000, 2500>().size() == 1500, "");
+        static_assert(ls.substring<1000, 2500>() == ls.substring<1, 1501>(), "");
+        static_assert(ls.reverse().reverse() == ls, "");
+        static_assert(ls.reverse().find("cba") == 0, "");
+        static_assert(ls.prefix<1500>() + ls.suffix<1500>() == ls, "");
+        static_assert((ls + ls).size() == 6000, "");
+        static_assert((ls + ls).count('b') == 2000, "");
+        static_assert(ls.upper().lower() == ls, "");
+        static_assert(ls.upper().count('C') == 1000, "");
+    }
 
     { // struct methods tests
         constexpr auto ss0 = ""_ss;
@@ -861,6 +1014,935 @@ int main() {
         static_assert(!ss3.contains("acabcabc"), "");
     }
 
+    { // static_string_hash() tests
+        constexpr auto ss = "Hello, World! \x01\x7f\x80\xff\xfe 0123456789 abcdefghijklmnopqrstuvwxyz"_ss;
+        constexpr auto ws = L"Hello, World! \u00ff\u0100\uffff 0123456789 abcdefghijklmnopqrstuvwxyz"_ss;
+        static_assert(static_string_hash(ss) == ss.hash(), "");
+        static_assert(static_string_hash("Hello") == "Hello"_ss.hash(), "");
+        static_assert(static_string_hash(L"Hello") == L"Hello"_ss.hash(), "");
+        check_hash_prefixes(ss, std::make_index_sequence<ss.size() + 1>{});
+        check_hash_prefixes(ws, std::make_index_sequence<ws.size() + 1>{});
+        CHECK(static_string_hash("", 0) == 5381ULL);
+        CHECK(static_string_hash("Hello", 5) == 210724412158ULL);
+        CHECK(static_string_hash("HelloWorldHelloWorld", 20) == 889607825945456465ULL);
+#define REPEAT10(x) x x x x x x x x x x
+        constexpr auto ls = REPEAT10(REPEAT10(REPEAT10("abc\xe0"))) ""_ss;
+#undef REPEAT10
+        constexpr unsigned long long lhash = ls.hash();
+        CHECK(static_string_hash(&ls.data[0], ls.size()) == lhash);
+        const char* strs[] = {"", "Hello", "HelloWorld", "HelloWorldHelloWorld", &ls.data[0]};
+        const size_t lengths[] = {0, 5, 10, 20, ls.size()};
+        unsigned long long hashes[5] = {};
+        static_string_hash(strs, lengths, 5, hashes);
+        CHECK(hashes[0] == ""_ss.hash());
+        CHECK(hashes[1] == "Hello"_ss.hash());
+        CHECK(hashes[2] == "HelloWorld"_ss.hash());
+        CHECK(hashes[3] == "HelloWorldHelloWorld"_ss.hash());
+        CHECK(hashes[4] == lhash);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(static_string_hash(std::string_view("HelloWorld")) == "HelloWorld"_ss.hash());
+        CHECK(static_string_hash(std::wstring_view(L"HelloWorld")) == L"HelloWorld"_ss.hash());
+        const std::string_view views[] = {"", "Hello", "HelloWorld"};
+        static_string_hash(views, 3, hashes);
+        CHECK(hashes[0] == ""_ss.hash() && hashes[1] == "Hello"_ss.hash() && hashes[2] == "HelloWorld"_ss.hash());
+#endif
+    }
+
+    { // hash<Algo>() tests
+        static_assert(""_ss.hash<fnv1a_hash>() == 0xcbf29ce484222325ULL, "");
+        static_assert("a"_ss.hash<fnv1a_hash>() == 0xaf63dc4c8601ec8cULL, "");
+        static_assert("foobar"_ss.hash<fnv1a_hash>() == 0x85944171f73967e8ULL, "");
+        static_assert(""_ss.hash<xxhash64>() == 0xef46db3751d8e999ULL, "");
+        static_assert("abc"_ss.hash<xxhash64>() == 0x44bc2cf5ad770999ULL, "");
+        static_assert("Hello, World!"_ss.hash<xxhash64>() == 0xc49aacf8080fe47fULL, "");
+        static_assert("abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"_ss.hash<xxhash64>(12345) ==
+            0x2eb8eacd1c83575aULL, "");
+        static_assert(L"Hello"_ss.hash<xxhash64>() == (sizeof(wchar_t) == 4 ? 0x55bdf3e109a2ba47ULL : L"Hello"_ss.hash<xxhash64>()), "");
+        static_assert(""_ss.hash<wyhash>(0) == 0x42bc986dc5eec4d3ULL, "");
+        static_assert("a"_ss.hash<wyhash>(1) == 0x84508dc903c31551ULL, "");
+        static_assert("abc"_ss.hash<wyhash>(2) == 0x0bc54887cfc9ecb1ULL, "");
+        static_assert("message digest"_ss.hash<wyhash>(3) == 0x6e2ff3298208a67cULL, "");
+        static_assert("abcdefghijklmnopqrstuvwxyz"_ss.hash<wyhash>(4) == 0x9a64e42e897195b9ULL, "");
+        static_assert("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789"_ss.hash<wyhash>(5) ==
+            0x9199383239c32554ULL, "");
+        static_assert("12345678901234567890123456789012345678901234567890123456789012345678901234567890"_ss.hash<wyhash>(6) ==
+            0x7c1ccf6bba30f5a5ULL, "");
+        static_assert(""_ss.hash<siphash>(0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL) == 0x726fdb47dd0e0e31ULL, "");
+        static_assert("\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e"_ss.hash<siphash>(
+            0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL) == 0xa129ca6149be45e5ULL, "");
+        static_assert("Hello"_ss.hash<siphash>(1, 2) != "Hello"_ss.hash<siphash>(2, 1), "");
+        constexpr auto ss = "The quick brown fox jumps over the lazy dog \x80\xff 0123456789 THE QUICK BROWN FOX"_ss;
+        constexpr auto ws = L"The quick brown fox jumps over the lazy dog \u00ff\uffff"_ss;
+        check_hash_algorithm_prefixes<fnv1a_hash>(ss, std::make_index_sequence<50>{});
+        check_hash_algorithm<fnv1a_hash>(ss);
+        check_hash_algorithm_prefixes<xxhash64>(ss, std::make_index_sequence<50>{});
+        check_hash_algorithm<xxhash64>(ss);
+        check_hash_algorithm_prefixes<wyhash>(ss, std::make_index_sequence<50>{});
+        check_hash_algorithm<wyhash>(ss);
+        check_hash_algorithm_prefixes<siphash>(ss, std::make_index_sequence<50>{});
+        check_hash_algorithm<siphash>(ss);
+        check_hash_algorithm_prefixes<xxhash64>(ws, std::make_index_sequence<20>{});
+        check_hash_algorithm<xxhash64>(ws);
+        check_hash_algorithm_prefixes<wyhash>(ws, std::make_index_sequence<20>{});
+        check_hash_algorithm<wyhash>(ws);
+        CHECK(static_string_hash<xxhash64>("abc", 3) == 0x44bc2cf5ad770999ULL);
+        CHECK(static_string_hash<wyhash>("abc", 3, 2) == 0x0bc54887cfc9ecb1ULL);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(static_string_hash<fnv1a_hash>(std::string_view("foobar")) == 0x85944171f73967e8ULL);
+        CHECK(static_string_hash<siphash>(std::string_view("Hello"), 1, 2) == "Hello"_ss.hash<siphash>(1, 2));
+#endif
+    }
+
+    { // static_string_map tests
+        constexpr auto map = make_static_string_map(
+            std::make_pair("GET"_ss, 1), std::make_pair("HEAD"_ss, 2), std::make_pair("POST"_ss, 3),
+            std::make_pair("PUT"_ss, 4), std::make_pair("DELETE"_ss, 5), std::make_pair("CONNECT"_ss, 6),
+            std::make_pair("OPTIONS"_ss, 7), std::make_pair("TRACE"_ss, 8), std::make_pair("PATCH"_ss, 9),
+            std::make_pair(""_ss, 0));
+        static_assert(map.size() == 10, "");
+        static_assert(!map.empty(), "");
+        static_assert(map.contains("GET"_ss), "");
+        static_assert(map.contains("PATCH"), "");
+        static_assert(map.contains(""), "");
+        static_assert(!map.contains("get"), "");
+        static_assert(!map.contains("PATCHES"_ss), "");
+        static_assert(map.at("GET") == 1, "");
+        static_assert(map.at("HEAD"_ss) == 2, "");
+        static_assert(map.at("DELETE") == 5, "");
+        static_assert(map.at("OPTIONS") == 7, "");
+        static_assert(map.at("") == 0, "");
+        const char* methods[] = {"GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH"};
+        for (int i = 0; i < 9; ++i) {
+            const std::string method = methods[i];
+            CHECK(map.find(method.data(), method.size()) != nullptr);
+            CHECK(*map.find(method.data(), method.size()) == i + 1);
+            CHECK(map.contains(method.data(), method.size()));
+            CHECK(!map.contains(method.data(), method.size() - 1));
+        }
+        CHECK(map.find("", 0) != nullptr && *map.find("", 0) == 0);
+        CHECK(map.find("GETS", 4) == nullptr);
+        CHECK(map.find("POSTPUT", 4) != nullptr && *map.find("POSTPUT", 4) == 3);
+        constexpr auto wmap = make_static_string_map(std::make_pair(L"one"_ss, 1u), std::make_pair(L"two"_ss, 2u));
+        static_assert(wmap.at(L"two") == 2u, "");
+        static_assert(!wmap.contains(L"three"), "");
+        CHECK(*wmap.find(L"one", 3) == 1u);
+        static_assert("Ab"_ss.hash() == "ba"_ss.hash(), "");
+        constexpr auto colliding = make_static_string_map(std::make_pair("Ab"_ss, 1), std::make_pair("ba"_ss, 2),
+            std::make_pair("BB"_ss, 3), std::make_pair("aC"_ss, 4));
+        static_assert(colliding.at("Ab") == 1 && colliding.at("ba") == 2 && colliding.at("BB") == 3 && colliding.at("aC") == 4, "");
+        static_assert(!colliding.contains("AB") && !colliding.contains("bA"), "");
+        CHECK(*colliding.find("Ab", 2) == 1 && *colliding.find("ba", 2) == 2 && colliding.find("ab", 2) == nullptr);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(*map.find(std::string_view("TRACE")) == 8);
+        CHECK(map.contains(std::string_view("CONNECT")));
+        CHECK(!map.contains(std::string_view("CONNECTED")));
+        CHECK(map.index(std::string_view("X")) == map.npos);
+#endif
+    }
+
+    { // static_string_switch tests
+        constexpr auto verbs = make_static_string_switch("GET"_ss, "PUT"_ss, "POST"_ss, "HEAD"_ss,
+            "DELETE"_ss, "ab"_ss, "ac"_ss, "bb"_ss, ""_ss);
+        static_assert(verbs.size() == 9, "");
+        static_assert(verbs.index("GET") == 0, "");
+        static_assert(verbs.index("PUT"_ss) == 1, "");
+        static_assert(verbs.index("DELETE") == 4, "");
+        static_assert(verbs.index("bb") == 7, "");
+        static_assert(verbs.index("") == 8, "");
+        static_assert(verbs.index("GOT") == verbs.npos, "");
+        static_assert(verbs.index("PATCH") == verbs.npos, "");
+        static_assert(verbs.index("DELETED") == verbs.npos, "");
+        const char* labels[] = {"GET", "PUT", "POST", "HEAD", "DELETE", "ab", "ac", "bb", ""};
+        for (size_t i = 0; i < 9; ++i) {
+            const std::string label = labels[i];
+            CHECK(verbs.index(label.data(), label.size()) == i);
+            switch (verbs.index(label.data(), label.size())) {
+                case verbs.index("GET"): CHECK(label == "GET"); break;
+                case verbs.index("DELETE"): CHECK(label == "DELETE"); break;
+                default: CHECK(label != "GET" && label != "DELETE"); break;
+            }
+        }
+        CHECK(verbs.index("PUX", 3) == verbs.npos);
+        CHECK(verbs.index("XET", 3) == verbs.npos);
+        CHECK(verbs.index("ba", 2) == verbs.npos);
+        CHECK(verbs.index("DELETE", 5) == verbs.npos);
+        CHECK(verbs.index("DELETE!", 7) == verbs.npos);
+        const auto methods = make_static_string_switch("GET"_ss, "POST"_ss);
+        int calls = 0;
+        CHECK(methods("POST", 4, [] { return -1; }, [&] { return ++calls; }, [&] { return calls += 10; }) == 10);
+        CHECK(methods("GET", 3, [] { return -1; }, [&] { return ++calls; }, [&] { return calls += 10; }) == 11);
+        CHECK(methods("PUT", 3, [] { return -1; }, [&] { return ++calls; }, [&] { return calls += 10; }) == -1);
+        methods("GET", 3, [] {}, [&] { calls = 0; }, [] {});
+        CHECK(calls == 0);
+        constexpr auto wverbs = make_static_string_switch(L"one"_ss, L"two"_ss, L"three"_ss);
+        static_assert(wverbs.index(L"two") == 1, "");
+        CHECK(wverbs.index(L"three", 5) == 2);
+        CHECK(wverbs.index(L"thref", 5) == wverbs.npos);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(verbs.index(std::string_view("HEAD")) == 3);
+        CHECK(methods(std::string_view("POST"), [] { return 0; }, [] { return 1; }, [] { return 2; }) == 2);
+#endif
+    }
+
+    { // static_string interning tests
+        const auto& a = "interned"_si;
+        const auto& b = "interned"_si;
+        static_assert(&"interned"_si == &"interned"_si, "");
+        static_assert("interned"_si == "interned", "");
+        CHECK(&a == &b);
+        CHECK(&a.data[0] == &b.data[0]);
+        CHECK(static_cast<const void*>(&"interned"_si) != static_cast<const void*>(&"internal"_si));
+        CHECK(&L"wide"_si == &L"wide"_si);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        const auto& c = SSINTERN("inter"_ss + "ned");
+        const auto& d = SSINTERN(ITOSS(12345));
+        CHECK(&c == &a);
+        CHECK(&d == &SSINTERN("12345"_ss));
+        CHECK(d == "12345");
+#endif
+        constexpr auto table = SSTABLE("GET"_ss, "ET"_ss, "POST"_ss, "GET"_ss, "T"_ss, ""_ss, "PUT"_ss);
+        static_assert(table.size() == 7, "");
+        static_assert(table.length() == 13, "");
+        static_assert(table.offset(0) == 5, "");
+        static_assert(table.offset(1) == 6, "");
+        static_assert(table.offset(2) == 0, "");
+        static_assert(table.offset(3) == table.offset(0), "");
+        static_assert(table.offset(4) == 3, "");
+        static_assert(table.offset(5) == 4, "");
+        static_assert(table.offset(6) == 9, "");
+        static_assert(table.length(1) == 2, "");
+        static_assert(table.offset_of("ST") == table.npos, "");
+        static_assert(table.offset_of("PUT"_ss) == 9, "");
+        const char* strs[] = {"GET", "ET", "POST", "GET", "T", "", "PUT"};
+        for (size_t i = 0; i < table.size(); ++i) {
+            CHECK(std::strcmp(table[i], strs[i]) == 0);
+            CHECK(std::strlen(table.c_str(i)) == table.length(i));
+        }
+        constexpr auto empty = SSTABLE(""_ss);
+        static_assert(empty.length() == 1, "");
+        static_assert(make_static_string_table<4>("abc"_ss, "bc"_ss).offset(1) == 1, "");
+        constexpr auto wtable = SSTABLE(L"one"_ss, L"ne"_ss);
+        static_assert(wtable.length() == 4, "");
+        CHECK(std::wcscmp(wtable[1], L"ne") == 0);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        static_assert(table.view(2) == "POST", "");
+        static_assert(table.view(1) == "ET", "");
+#endif
+    }
+
+    { // conversion tests
+        constexpr auto str = "Hello, World!"_ss;
+        constexpr auto wstr = L"Hello"_ss;
+        CHECK(str.str() == "Hello, World!");
+        CHECK(wstr.str() == L"Hello");
+        CHECK(to_string(str) == "Hello, World!");
+        CHECK(to_string(wstr) == L"Hello");
+        CHECK(to_string(""_ss).empty());
+        static_assert(str.c_str()[4] == 'o', "");
+        size_t allocations = 0;
+        const auto long_str = "a string long enough to need a heap allocation"_ss;
+        const auto copy = long_str.str(counting_allocator<char>(allocations));
+        CHECK(copy.size() == long_str.size() && allocations == 1);
+        CHECK(to_string(long_str, counting_allocator<char>(allocations)) == copy.c_str() && allocations == 2);
+        char buffer[8] = {};
+        CHECK(str.copy(buffer, 5) == 5 && std::strcmp(buffer, "Hello") == 0);
+        CHECK(str.copy(buffer, str.npos, 7) == 6 && std::strncmp(buffer, "World!", 6) == 0);
+        CHECK(str.copy(buffer, 3, 13) == 0);
+        bool thrown = false;
+        try {
+            str.copy(buffer, 1, 14);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        CHECK(thrown);
+        std::ostringstream out;
+        out << str << '|' << ""_ss << '|' << std::setw(7) << "abc"_ss << '|' << std::left << std::setw(4) << "x"_ss << '|';
+        CHECK(out.str() == "Hello, World!||    abc|x   |");
+        std::ostringstream zero;
+        zero << "a\0b"_ss << '|' << std::setw(5) << "a\0b"_ss << '|' << std::left << std::setfill('.') << std::setw(4) << "a\0b"_ss << '|';
+        CHECK(zero.str() == std::string("a\0b|  a\0b|a\0b.|", 15));
+        std::wostringstream wout;
+        wout << wstr << L'!';
+        CHECK(wout.str() == L"Hello!");
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        static_assert(str.view() == "Hello, World!", "");
+        static_assert(to_string_view(wstr).size() == 5, "");
+        const std::string_view view = str;
+        CHECK(view.substr(7) == "World!" && view.data() == str.c_str());
+#endif
+    }
+
+    { // static_format tests
+        constexpr auto fmt = SSFORMAT("user={} took {}ms"_ss);
+        static_assert(fmt.slots() == 2, "");
+        static_assert(fmt.literal_length() == 13, "");
+        static_assert(fmt.max_size<int, unsigned long long>() == 13 + 11 + 20, "");
+        char buffer[fmt.max_size<int, unsigned long long>()];
+        size_t length = fmt.format(buffer, -42, 18446744073709551615ULL);
+        CHECK(std::string(buffer, length) == "user=-42 took 18446744073709551615ms");
+        length = fmt.format(buffer, std::numeric_limits<int>::min(), 0ULL);
+        CHECK(std::string(buffer, length) == "user=-2147483648 took 0ms");
+        CHECK(fmt.str("bob", 7) == "user=bob took 7ms");
+        CHECK(fmt.str(std::string("alice"), 1.5) == "user=alice took 1.5ms");
+        CHECK(fmt.str("root"_ss, true) == "user=root took truems");
+        CHECK(fmt.str('x', 0.1f) == "user=x took 0.1ms");
+        bool thrown = false;
+        try {
+            char small[16];
+            fmt.format(small, 1, 2);
+        } catch (const std::length_error&) {
+            thrown = true;
+        }
+        CHECK(thrown);
+        constexpr auto escaped = SSFORMAT("{{{}}} {{}}");
+        static_assert(escaped.slots() == 1, "");
+        static_assert(escaped.literal_length() == 5, "");
+        CHECK(escaped.str(5) == "{5} {}");
+        constexpr auto plain = SSFORMAT("no slots");
+        CHECK(plain.str() == "no slots");
+        constexpr auto only = SSFORMAT("{}");
+        CHECK(only.str(-0) == "0" && only.str(""_ss).empty());
+        // shortest round trip like DTOSS, within the bound for the longest values
+        CHECK(only.str(0.1 + 0.2) == "0.30000000000000004" && only.str(1e22) == "1e+22" && only.str(123456789.0) == "123456789");
+        CHECK(only.str(-std::numeric_limits<double>::denorm_min()) == "-5e-324" && only.str(-0.0) == "-0");
+        CHECK(only.str(-1.2345678901234568e-300) == "-1.2345678901234568e-300" && only.max_size<double>() == 25);
+        CHECK(only.str(16777216.0f) == "16777216" && only.str(-1.17549435e-38f) == "-1.1754944e-38" && only.max_size<float>() == 17);
+        CHECK(only.str(std::numeric_limits<long double>::quiet_NaN()) == "nan" && only.str(-std::numeric_limits<float>::infinity()) == "-inf");
+        static_assert(static_string_format_slots("{}{}{}") == 3, "");
+        constexpr auto wfmt = SSFORMAT(L"{}: {}"_ss);
+        CHECK(wfmt.str(L"pi", 3.14159) == L"pi: 3.14159");
+        CHECK(wfmt.str(-1LL, L'w') == L"-1: w");
+        static_assert(wfmt.max_size<char, char>() == 4, "");
+        CHECK(wfmt.str('a', 'b') == L"a: b" && wfmt.str('\xe9', 1) == L"\xe9: 1");
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(fmt.str(std::string_view("carol"), 12u) == "user=carol took 12ms");
+#endif
+    }
+
+    { // basic_fixed_string tests
+        const auto prefix = "[info] "_ss;
+        fixed_string<16> name("request", 7);
+        const auto line = prefix + name + " done";
+        static_assert(decltype(line)::capacity() == 7 + 16 + 5, "");
+        CHECK(line == "[info] request done");
+        CHECK(line.size() == 19 && line.c_str()[19] == '\0');
+        CHECK(line.find('e') == 8 && line.find('e', 9) == 11 && line.find('e', 0, 2) == 18);
+        CHECK(line.find('z') == line.npos);
+        CHECK(line.find("request") == 7 && line.find("req"_ss, 8) == line.npos);
+        CHECK(line.find("e", 0, 1) == 11 && line.find("") == 0);
+        CHECK(line.rfind('e') == 18 && line.rfind('e', 17) == 11 && line.rfind('e', line.npos, 2) == 8);
+        CHECK(line.rfind("e") == 18 && line.rfind("[info]") == 0 && line.rfind("done", 14) == line.npos);
+        CHECK(line.starts_with(prefix) && line.starts_with("[info] r") && !line.starts_with("[warn]"));
+        CHECK(line.ends_with("done") && line.ends_with(name + " done") && !line.ends_with("[info]"));
+        CHECK(line.contains(name) && line.contains('q') && !line.contains("info] d"));
+        CHECK(line.count('e') == 3 && line.count('x') == 0);
+        CHECK(line.hash() == static_string_hash("[info] request done"));
+        CHECK(line.hash<xxhash64>(7) == "[info] request done"_ss.hash<xxhash64>(7));
+        CHECK(line.str() == "[info] request done");
+        CHECK(line < name && name > line && name <= "request"_ss && "request" >= name);
+        CHECK(name != line && "request"_ss == name && name == std::string("request"));
+        fixed_string<8> small;
+        CHECK(small.empty() && small.size() == 0 && small.find('a') == small.npos && small.rfind('a') == small.npos);
+        small += "ab"_ss;
+        small += 'c';
+        small += "de";
+        small.push_back('f');
+        CHECK(small == "abcdef" && small.rfind("") == 6);
+        bool thrown = false;
+        try {
+            small.append("xyz", 3);
+        } catch (const std::length_error&) {
+            thrown = true;
+        }
+        CHECK(thrown && small == "abcdef");
+        small.resize(2);
+        CHECK(small == "ab" && small.c_str()[2] == '\0');
+        small.clear();
+        CHECK(small.empty());
+        fixed_string<16> copied(name);
+        CHECK(copied == "request" && copied.c_str()[7] == '\0');
+        copied = fixed_string<16>();
+        CHECK(copied.empty() && copied.c_str()[0] == '\0');
+        copied = name;
+        copied = static_cast<const fixed_string<16>&>(copied);
+        CHECK(copied == name && copied.size() == 7);
+        fixed_wstring<8> wide(L"wide");
+        CHECK(wide == L"wide"_ss && wide.find(L"de") == 2);
+        std::ostringstream out;
+        out << line << '|' << std::setw(9) << name;
+        CHECK(out.str() == "[info] request done|  request");
+        fixed_string<8> zero("a", 1);
+        zero.append("\0b", 2);
+        std::ostringstream padded;
+        padded << zero << '|' << std::setw(5) << zero << '|' << std::setw(2) << zero;
+        CHECK(padded.str() == std::string("a\0b|  a\0b|a\0b", 13));
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        const fixed_string<32> copy(std::string_view("[info] request done"));
+        CHECK(copy == line && copy.view() == line.view() && copy.find(std::string_view("done")) == 15);
+#endif
+    }
+
+    { // make_fixed_string tests
+        const std::string host = "web-01";
+        const int shard = -7;
+        const auto key = make_fixed_string("metrics."_ss, bounded<16>(host), '.', shard, ".latency_", 250u, "ms");
+        static_assert(decltype(key)::capacity() == 8 + 16 + 1 + 11 + 9 + 10 + 2, "");
+        CHECK(key == "metrics.web-01.-7.latency_250ms");
+        const fixed_string<4> level("warn", 4);
+        const auto prefix = make_fixed_string('[', level, "] ", true, ' ', 1.25);
+        static_assert(decltype(prefix)::capacity() == 1 + 4 + 2 + 5 + 1 + 25, "");
+        CHECK(prefix == "[warn] true 1.25");
+        char name[8] = "abc";
+        CHECK(make_fixed_string(name, '|') == "abc|");
+        CHECK(make_fixed_string().empty());
+        static_assert(std::is_same<decltype(make_fixed_string(1, 2)), fixed_string<22>>::value, "");
+        const auto wide = make_fixed_string(L"id="_ss, 42, L'!');
+        CHECK(wide == L"id=42!");
+        bool thrown = false;
+        try {
+            bounded<2>(host);
+        } catch (const std::length_error&) {
+            thrown = true;
+        }
+        CHECK(thrown);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(make_fixed_string(bounded<8>(std::string_view("sv")), "!"_ss) == "sv!");
+#endif
+    }
+
+    { // static_searcher tests
+        constexpr auto marker = make_static_searcher("ERROR:"_ss);
+        static_assert(marker.size() == 6, "");
+        static_assert(marker.shift('E') == 5 && marker.shift('R') == 1 && marker.shift(':') == 6 && marker.shift('x') == 6, "");
+        const std::string log = std::string(1000, '.') + "ERROR" + std::string(100, ' ') + "ERROR: disk full";
+        CHECK(marker.find(log) == 1105);
+        CHECK(marker.find(log, 1106) == marker.npos);
+        CHECK(marker.find(log.data(), 1110) == marker.npos);
+        CHECK(marker.find(log.data(), 1111) == 1105);
+        CHECK(marker.find("ERROR:", 6) == 0 && marker.find("ERROR", 5) == marker.npos && marker.find("", 0) == marker.npos);
+        check_searcher(make_static_searcher("a"), "a");
+        check_searcher(make_static_searcher("ab"), "ab");
+        check_searcher(make_static_searcher("bab"), "bab");
+        check_searcher(make_static_searcher("aabba"), "aabba");
+        check_searcher(make_static_searcher("abbabaabbaabab"), "abbabaabbaabab");
+        check_searcher(make_static_searcher("babababababababababababababababababa"), "babababababababababababababababababa");
+        constexpr auto empty = make_static_searcher("");
+        CHECK(empty.find("abc", 3, 1) == 1 && empty.find("abc", 3, 3) == 3 && empty.find("abc", 3, 4) == empty.npos);
+        constexpr auto wide = make_static_searcher(L"\u0141\u0142"_ss);
+        static_assert(wide.shift(L'\u0141') == 1 && wide.shift(L'\u0241') == 1, "");
+        const std::wstring wlog = L"\u0241\u0142\u0141\u0141\u0142";
+        CHECK(wide.find(wlog) == 3);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(marker.find(std::string_view(log).substr(1000)) == 105);
+#endif
+    }
+
+    { // static_string_automaton tests
+        constexpr auto tokens = SSAUTOMATON("he"_ss, "she"_ss, "his"_ss, "hers"_ss);
+        static_assert(tokens.size() == 4, "");
+        static_assert(tokens.states() == 10, "");
+        static_assert(tokens.classes() == 6, "");
+        static_assert(tokens.class_of('x') == 0 && tokens.class_of('e') != 0, "");
+        static_assert(sizeof(tokens.transitions) == 10 * 6 * sizeof(std::uint16_t), "");
+        std::string found;
+        tokens.scan("ushers and his hers", 19, [&](size_t keyword, size_t offset) {
+            found += std::to_string(keyword) + "@" + std::to_string(offset) + " ";
+        });
+        CHECK(found == "1@1 0@2 3@2 2@11 0@15 3@15 ");
+        found.clear();
+        size_t state = tokens.scan("xxsh", 4, [&](size_t keyword, size_t offset) {
+            found += std::to_string(keyword) + "@" + std::to_string(offset) + " ";
+        });
+        state = tokens.scan(std::string("ers"), [&](size_t keyword, size_t offset) {
+            found += std::to_string(keyword) + "@" + std::to_string(offset) + " ";
+        }, state, 4);
+        CHECK(found == "1@2 0@3 3@3 ");
+        constexpr auto nested = SSAUTOMATON("a", "aa", "aaa", "b");
+        static_assert(nested.states() == 5 && nested.classes() == 3, "");
+        size_t matches = 0, sum = 0;
+        nested.scan("aaaa", 4, [&](size_t keyword, size_t) { ++matches; sum += keyword; });
+        CHECK(matches == 9 && sum == 0 * 4 + 1 * 3 + 2 * 2);
+        constexpr auto wide = SSAUTOMATON(L"\u0430\u0431"_ss, L"b\u0431"_ss);
+        static_assert(wide.classes() == 4 && wide.class_of(L'\u0431') == 3 && wide.class_of(L'\u0432') == 0, "");
+        matches = 0;
+        wide.scan(L"\u0430\u0431b\u0431", 4, [&](size_t keyword, size_t offset) { matches += keyword * 10 + offset; });
+        CHECK(matches == 0 + 12);
+        const std::string keywords[] = {"GET", "POST", "PUT", "HEAD", "TRACE", "OPTIONS", "T /", "HTTP/1.1"};
+        constexpr auto methods = SSAUTOMATON("GET"_ss, "POST"_ss, "PUT"_ss, "HEAD"_ss, "TRACE"_ss, "OPTIONS"_ss, "T /"_ss, "HTTP/1.1"_ss);
+        const std::string traffic = "GET / HTTP/1.1\r\nPOST /x HTTP/1.1\r\nOPTIONS * HTTP/1.1\r\nPUTTRACEHEADGET";
+        size_t expected = 0;
+        for (size_t i = 0; i < 8; ++i)
+            for (size_t pos = traffic.find(keywords[i]); pos != std::string::npos; pos = traffic.find(keywords[i], pos + 1))
+                ++expected;
+        matches = 0;
+        methods.scan(traffic, [&](size_t keyword, size_t offset) {
+            CHECK(traffic.compare(offset, keywords[keyword].size(), keywords[keyword]) == 0);
+            ++matches;
+        });
+        CHECK(matches == expected);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        matches = 0;
+        tokens.scan(std::string_view("she"), [&](size_t, size_t) { ++matches; });
+        CHECK(matches == 2);
+#endif
+    }
+
+    { // static_regex tests
+        constexpr auto route = SSREGEX("^/api/v([0-9]+)/(users|groups)/([a-z0-9_-]+)(/keys)?$"_ss);
+        static_assert(route.groups() == 4, "");
+        static_assert(route.match("/api/v2/users/bob_1/keys"), "");
+        static_assert(route.match("/api/v10/groups/x"), "");
+        static_assert(!route.match("/api/v/users/bob"), "");
+        static_assert(!route.match("/api/v2/users/Bob"), "");
+        decltype(route)::captures_type captures{};
+        const std::string path = "/api/v12/groups/core-team/keys";
+        CHECK(route.match(path, captures));
+        CHECK(captures[0].begin == 0 && captures[0].end == path.size());
+        CHECK(path.substr(captures[1].begin, captures[1].length()) == "12");
+        CHECK(path.substr(captures[2].begin, captures[2].length()) == "groups");
+        CHECK(path.substr(captures[3].begin, captures[3].length()) == "core-team");
+        CHECK(captures[4].begin == 25 && captures[4].end == 30);
+        CHECK(route.match("/api/v1/users/u", 15, captures) && !captures[4].matched());
+        constexpr auto number = SSREGEX("-?\\d+(\\.\\d*)?"_ss);
+        static_assert(number.states() == 8, ""); // 5 forward, 3 reversed
+        static_assert(number.search("x = -12.5;").begin == 4 && number.search("x = -12.5;").end == 9, "");
+        static_assert(number.search("x = -12.5; y = 3"_ss, 9).begin == 15, "");
+        static_assert(!number.search("none").matched(), "");
+        decltype(number)::captures_type fraction{};
+        CHECK(number.search(std::string("pi 3.14"), fraction).begin == 3 && fraction[1].begin == 4 && fraction[1].end == 7);
+        constexpr auto alternation = SSREGEX("(a|ab)(c|bcd)(d*)"_ss);
+        std::array<static_regex_span, 4> groups{};
+        CHECK(alternation.match("abcd", 4, groups));
+        CHECK(groups[1].end == 1 && groups[2].begin == 1 && groups[2].end == 4 && groups[3].begin == 4 && groups[3].end == 4);
+        constexpr auto classes = SSREGEX("[^a-c]+\\s*(?:x|yz?)|\\w\\W.");
+        static_assert(classes.groups() == 0, "");
+        static_assert(classes.match("dd y") && classes.match("dyz") && classes.match("a!b") && !classes.match("ad y"), "");
+        constexpr auto anchored = SSREGEX("ab$");
+        static_assert(anchored.search("abab").begin == 2 && !anchored.search("aba").matched(), "");
+        static_assert(SSREGEX("a|b$").search("ax").end == 1 && SSREGEX("a|b$").search("xb").begin == 1 && !SSREGEX("a|b$").search("bx").matched(), "");
+        static_assert(SSREGEX("^a|b").search("xb").begin == 1 && !SSREGEX("^a|b").search("xa").matched() && !SSREGEX("a^b").match("ab"), "");
+        constexpr auto separated = SSREGEX("(^|,)(x+)$");
+        std::array<static_regex_span, 3> items{};
+        CHECK(separated.search("y,xx", 4, items).begin == 1 && items[1].length() == 1 && items[2].begin == 2 && items[2].end == 4);
+        CHECK(separated.search("xx", 2, items).begin == 0 && items[1].begin == 0 && items[1].end == 0 && !separated.search("yxx").matched());
+        // linear in the input, not in the input times the match attempts
+        CHECK(!SSREGEX("a*b").search(std::string(100000, 'a')).matched() && SSREGEX("a*b").search(std::string(100000, 'a') + "b").begin == 0);
+        const auto unsupported = [](const auto& pattern) {
+            try {
+                static_regex_classes(pattern);
+            } catch (const std::invalid_argument&) {
+                return true;
+            }
+            return false;
+        };
+        CHECK(unsupported("\\b") && unsupported("\\B") && unsupported("\\1") && unsupported("[\\b]") && unsupported("a\\z"));
+        CHECK(!unsupported("\\.\\$\\^\\n[\\-\\]]"));
+        constexpr auto empty = SSREGEX("");
+        static_assert(empty.match("") && !empty.match("a") && empty.search("abc"_ss, 2).begin == 2, "");
+        constexpr auto glob = SSGLOB("*.[ch]pp");
+        static_assert(glob.match("static_string.hpp") && glob.match(".cpp") && !glob.match("a.hxx") && !glob.match("a.cpp~"), "");
+        constexpr auto question = SSGLOB("log-??.[!0-9]*");
+        static_assert(question.match("log-01.txt") && !question.match("log-1.txt") && !question.match("log-01.1"), "");
+        static_assert(SSGLOB("a\\*b").match("a*b") && !SSGLOB("a\\*b").match("axb"), "");
+        constexpr auto wide = SSREGEX(L"\u0430+[\u0431-\u0433]"_ss);
+        static_assert(wide.match(L"\u0430\u0430\u0432") && !wide.match(L"\u0430\u0434"), "");
+        static_assert(wide.class_of(L'\u0432') == wide.class_of(L'\u0431') && wide.class_of(L'a') == 0, "");
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(route.match(std::string_view("/api/v3/users/me")));
+#endif
+    }
+
+    { // static_config tests
+        static constexpr auto config = SSCONFIG("# defaults\nname = \"demo; server\"\n[server]\nhost = localhost\nport=8080 \n"
+            "debug = on; timeout = -1.5e3\n[ limits ]\nmax_connections = 18446744073709551615;ratio=0.1\n"_ss);
+        static_assert(config.size() == 7, "");
+        static_assert(config.key(0) == "name" && config.value(0) == "demo; server" && config.section(0).empty(), "");
+        static_assert(config.section(5) == "limits" && config.key(5) == "max_connections", "");
+        static_assert(config.contains("server.port") && !config.contains("port") && !config.contains("server.por"), "");
+        static_assert(config.get<int>("server.port") == 8080 && config.get<unsigned short>("server.port") == 8080, "");
+        static_assert(config.get<bool>("server.debug") && config.get<double>("server.timeout") == -1500.0, "");
+        static_assert(config.get<double>("limits.ratio") == 0.1, "");
+        static_assert(config.get<unsigned long long>("limits.max_connections") == std::numeric_limits<unsigned long long>::max(), "");
+        static_assert(config.get_string("server.host") == "localhost" && config.get_string("name") != "demo", "");
+        static_assert(config.get<int>("server.workers", 4) == 4 && config.get<int>("server.port", 4) == 8080, "");
+        static_assert(config.index("limits.ratio"_ss) == 6 && config.index("ratio") == config.npos, "");
+        struct server_settings {
+            basic_static_config_value<char> host;
+            unsigned short port;
+            bool debug;
+        };
+        constexpr server_settings settings{config.get_string("server.host"), config.get<unsigned short>("server.port"),
+            config.get<bool>("server.debug")};
+        static_assert(settings.host == "localhost" && settings.port == 8080 && settings.debug, "");
+        constexpr auto typed = config.get_tuple<int, bool>("server.port", "server.debug");
+        static_assert(std::get<0>(typed) == 8080 && std::get<1>(typed), "");
+        constexpr auto flat = SSCONFIG("a=1;b=-9223372036854775808;;c=");
+        static_assert(flat.size() == 3 && flat.get<long long>("b") == std::numeric_limits<long long>::min(), "");
+        static_assert(flat.get_string("c").empty() && flat.get<char>("a") == 1, "");
+        static_assert(SSCONFIG("# nothing here\n").size() == 0, "");
+        constexpr auto wide = SSCONFIG(L"[w]\nk = аб"_ss);
+        static_assert(wide.get_string(L"w.k") == L"аб", "");
+        CHECK(config.get_string("server.host").str() == "localhost");
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        static_assert(config.get_string("name").view() == "demo; server", "");
+#endif
+    }
+
+    { // parse tests
+        static_assert(parse<int>("-2147483648").value == std::numeric_limits<int>::min(), "");
+        static_assert(parse<int>("2147483648").error == parse_error::out_of_range, "");
+        static_assert(parse<unsigned char>("+255") && !parse<unsigned char>("256"), "");
+        static_assert(parse<unsigned>("-1").error == parse_error::invalid_argument, "");
+        static_assert(parse<int>("12a4").error == parse_error::invalid_argument && parse<int>("12a4").position == 2, "");
+        static_assert(!parse<int>("") && !parse<int>("-") && !parse<int>(" 1") && !parse<int>("1", 37), "");
+        static_assert(parse<int>("ff", 16).value == 255 && parse<int>("0xFF", 16).value == 255 && parse<int>("0xff", 0).value == 255, "");
+        static_assert(parse<int>("-0b101", 0).value == -5 && parse<int>("017", 0).value == 15 && parse<int>("0", 0), "");
+        static_assert(parse<long long>("zz", 36).value == 1295 && parse<int>("0x", 0).position == 1, "");
+        static_assert(parse<unsigned long long>("18446744073709551615"_ss).value == std::numeric_limits<unsigned long long>::max(), "");
+        static_assert(parse<unsigned long long>("18446744073709551616").error == parse_error::out_of_range, "");
+        const char* overflows[] = {"18446744073709551616", "100000000000000000000000", "123456789012345678901234",
+            "99999999999999999999999999999999", "000000000000000000000000000000018446744073709551616"};
+        for (const char* field : overflows) {
+            const parse_result<unsigned long long> runtime = parse<unsigned long long>(field, field + std::strlen(field));
+            const parse_result<unsigned long long> reference = __static_string_detail::parse_integer<unsigned long long>(field, std::strlen(field), 10);
+            CHECK(runtime.error == parse_error::out_of_range && runtime.position == reference.position);
+            CHECK(parse<long long>(std::string("-") + field).error == parse_error::out_of_range);
+        }
+        CHECK(parse<unsigned long long>(std::string("10000000000000000000")).value == 10000000000000000000ULL);
+        CHECK(parse<unsigned long long>(std::string("000000000000000018446744073709551615")).value == std::numeric_limits<unsigned long long>::max());
+        static_assert("-1234"_ss.parse<short>().value == -1234 && "777"_ss.parse<int>(8).value == 511, "");
+        static_assert(parse<double>("0.1").value == 0.1 && parse<double>("-1.5e3").value == -1500.0, "");
+        static_assert(parse<double>("1.7976931348623157e308").value == std::numeric_limits<double>::max(), "");
+        static_assert(parse<double>("1e309").error == parse_error::out_of_range && parse<double>("1e-400").error == parse_error::out_of_range, "");
+        static_assert(parse<float>("3.4028235e38").value == std::numeric_limits<float>::max(), "");
+        static_assert(parse<double>("123456789012345678901234567890").value == 123456789012345678901234567890.0, "");
+        static_assert(parse<double>("-INF").value == -std::numeric_limits<double>::infinity() && parse<double>("nan").value != parse<double>("nan").value, "");
+        static_assert(!parse<double>("1e") && !parse<double>(".") && !parse<double>("1.2.3") && parse<double>("5.").value == 5.0, "");
+        static_assert(parse<double>(".5e+1").value == 5.0 && parse<double>("0e999999").value == 0.0 && !parse<double>("1", 16), "");
+        static_assert(parse<int>(L"-42"_ss).value == -42 && parse<double>(L"2.5").value == 2.5, "");
+        const char* fields[] = {"0", "7", "-7", "12345678", "123456789", "1234567812345678", "12345678123456789",
+            "9223372036854775807", "9223372036854775808", "-9223372036854775808", "-9223372036854775809",
+            "00000000000000000000000000042", "1234567x12345678", "12345678123456x8", "123456781234567812", "+", "", "99999999"};
+        for (const char* field : fields) {
+            const char* end = field + std::strlen(field);
+            const parse_result<long long> runtime = parse<long long>(field, end);
+            const parse_result<long long> reference = __static_string_detail::parse_integer<long long>(field, end - field, 10);
+            CHECK(runtime.value == reference.value && runtime.error == reference.error && runtime.position == reference.position);
+            const parse_result<unsigned> narrow = parse<unsigned>(std::string(field));
+            const parse_result<unsigned> narrow_reference = __static_string_detail::parse_integer<unsigned>(field, end - field, 10);
+            CHECK(narrow.value == narrow_reference.value && narrow.error == narrow_reference.error);
+        }
+        unsigned long long seed = 1;
+        for (int i = 0; i < 20000; ++i) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            std::ostringstream stream;
+            stream << std::setprecision(1 + static_cast<int>(seed >> 59)) << static_cast<double>(seed >> 11) *
+                std::pow(10.0, static_cast<int>((seed >> 3) % 80) - 60);
+            const std::string text = stream.str();
+            CHECK(parse<double>(text).value == std::strtod(text.c_str(), nullptr));
+            CHECK(parse<float>(text).value == std::strtof(text.c_str(), nullptr) || !parse<float>(text));
+            CHECK(parse<long long>(std::to_string(static_cast<long long>(seed))).value == static_cast<long long>(seed));
+        }
+        static_assert(parse<double>("-4.9e+297").value == -4.9e+297 && parse<double>("7.2345732939956e-288").value == 7.2345732939956e-288, "");
+        static_assert(parse<double>("4.9406564584124654e-324").value == std::numeric_limits<double>::denorm_min(), "");
+        static_assert(parse<double>("2.4703282292062328e-324").value == std::numeric_limits<double>::denorm_min(), "");
+        static_assert(parse<double>("2.4703282292062327e-324").error == parse_error::out_of_range, "");
+        static_assert(parse<double>("9007199254740993").value == 9007199254740992.0 && parse<double>("9007199254740995").value == 9007199254740996.0, "");
+        static_assert(parse<double>("1.7976931348623158e308").value == std::numeric_limits<double>::max() && !parse<double>("1.7976931348623159e308"), "");
+        static_assert(parse<float>("1.17549435e-38").value == std::numeric_limits<float>::min() && parse<float>("1.4e-45").value > 0, "");
+        // the digits past the 19th decide the rounding: 2^53 + 1 plus or minus a little
+        CHECK(parse<double>(std::string("9007199254740993.000000000000000000000000000001")).value == 9007199254740994.0);
+        CHECK(parse<double>(std::string("9007199254740992.999999999999999999999999999999")).value == 9007199254740992.0);
+        CHECK(parse<double>(std::string("0.") + std::string(400, '0') + "1e400").value == 0.1);
+        for (int i = 0; i < 200000; ++i) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            double value = 0;
+            std::memcpy(&value, &seed, sizeof(value));
+            if (!std::isfinite(value) || value == 0)
+                continue;
+            char text[64];
+            std::snprintf(text, sizeof(text), "%.*e", static_cast<int>(seed % 19), value);
+            const parse_result<double> result = parse<double>(text, text + std::strlen(text));
+            const double expected = std::strtod(text, nullptr);
+            CHECK(result.value == expected || (!result && (expected == 0 || std::isinf(expected))));
+            const float narrow = std::strtof(text, nullptr);
+            CHECK(parse<float>(std::string(text)).value == narrow || (!parse<float>(std::string(text)) && (narrow == 0 || std::isinf(narrow))));
+            if (i % 16 == 0)
+                CHECK(parse<long double>(std::string(text)).value == std::strtold(text, nullptr) || !parse<long double>(std::string(text)));
+        }
+        CHECK(parse<int>(std::wstring(L"0x1f"), 0).value == 31 && parse<double>(std::wstring(L"0.25")).value == 0.25);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(parse<int>(std::string_view("123456789", 4)).value == 1234);
+#endif
+    }
+
+    { // write_uint and write_int tests
+        char buffer[24] = {};
+        CHECK(std::string(buffer, write_uint(buffer, 0u)) == "0");
+        CHECK(std::string(buffer, write_uint(buffer, 7u)) == "7");
+        CHECK(std::string(buffer, write_uint(buffer, 10000u)) == "10000");
+        CHECK(std::string(buffer, write_uint(buffer, 4294967295u)) == "4294967295");
+        CHECK(std::string(buffer, write_uint(buffer, 4294967296ULL)) == "4294967296");
+        CHECK(std::string(buffer, write_uint(buffer, std::numeric_limits<unsigned long long>::max())) == "18446744073709551615");
+        CHECK(std::string(buffer, write_uint(buffer, static_cast<unsigned char>(255))) == "255");
+        CHECK(std::string(buffer, write_int(buffer, -1)) == "-1");
+        CHECK(std::string(buffer, write_int(buffer, std::numeric_limits<long long>::min())) == "-9223372036854775808");
+        CHECK(std::string(buffer, write_int(buffer, static_cast<short>(-32768))) == "-32768");
+        unsigned long long value = 1;
+        for (int i = 0; i < 20; ++i, value *= 10) {
+            CHECK(std::string(buffer, write_uint(buffer, value)) == std::to_string(value));
+            CHECK(std::string(buffer, write_uint(buffer, value - 1)) == std::to_string(value - 1));
+            CHECK(std::string(buffer, write_int(buffer, -static_cast<long long>(value / 10) - 1)) ==
+                std::to_string(-static_cast<long long>(value / 10) - 1));
+        }
+        wchar_t wide[24] = {};
+        CHECK(std::wstring(wide, write_int(wide, -1234567890123LL)) == L"-1234567890123");
+        CHECK(make_fixed_string("id=", 12345678901LL, '/', 42u) == "id=12345678901/42");
+    }
+
+    { // UTF tests
+        constexpr auto greeting = u"héllo, 世界 \U0001f600"_ss;
+        static_assert(greeting.size() == 12 && greeting.find(u'世') == 7, "");
+        static_assert(utf8_length(greeting) == 19 && utf32_length(greeting) == 11, "");
+        constexpr auto utf8 = SSUTF8(greeting);
+        static_assert(utf8 == "h\xc3\xa9llo, \xe4\xb8\x96\xe7\x95\x8c \xf0\x9f\x98\x80", "");
+        constexpr auto utf32 = SSUTF32(utf8);
+        static_assert(utf32 == U"héllo, 世界 \U0001f600" && utf32[10] == U'\U0001f600', "");
+        static_assert(SSUTF16(utf32) == greeting && SSUTF16(utf8) == greeting, "");
+        static_assert(SSUTF8("plain ascii") == "plain ascii" && SSUTF16("") == u"", "");
+        static_assert(SSUTF8(U"\u007f\u0080\u07ff\u0800\uffff\U00010000\U0010ffff") ==
+            "\x7f\xc2\x80\xdf\xbf\xe0\xa0\x80\xef\xbf\xbf\xf0\x90\x80\x80\xf4\x8f\xbf\xbf", "");
+        static_assert(SSUTF32(L"é世") == U"é世", "");
+        constexpr static_u16string_t<4> abc = u"abc"_ss;
+        constexpr static_u32string_t<4> xyz = static_u32string::make(U"x", U"y", U"z");
+        static_assert(abc.hash() != 0 && (abc + u"d").ends_with(u"cd") && xyz == U"xyz", "");
+        static_assert(U"ÉTÉ"_ss.lower() == U"ÉtÉ", ""); // ASCII only
+        CHECK(utf8.str() == std::string("h\xc3\xa9llo, \xe4\xb8\x96\xe7\x95\x8c \xf0\x9f\x98\x80"));
+        CHECK(greeting.str() == std::u16string(u"héllo, 世界 \U0001f600"));
+#ifdef __cpp_char8_t
+        constexpr auto u8 = u8"café"_ss;
+        static_assert(std::is_same<decltype(u8), const static_u8string_t<6>>::value, "");
+        static_assert(SSUTF16(u8) == u"café" && to_utf8<5, char8_t>(u"café") == u8, "");
+#endif
+    }
+
+    { // case-insensitive tests
+        constexpr auto header = "Content-Type"_ss;
+        static_assert(header.iequals("content-type") && header.iequals("CONTENT-TYPE"_ss), "");
+        static_assert(!header.iequals("content-typ") && !header.iequals("content_type"), "");
+        static_assert(header.icompare("CONTENT-TYPE") == 0 && header.icompare("content-length") > 0, "");
+        static_assert(header.icompare("content-type-x") < 0 && "abc"_ss.icompare("ABD"_ss) < 0, "");
+        static_assert(header.ifind('t') == 3 && header.ifind("TYPE") == 8 && header.ifind("t", 4) == 6, "");
+        static_assert(header.ifind("type", 9) == static_string::npos && header.ifind("") == 0, "");
+        static_assert(header.ihash() == header.lower().hash() && header.ihash() == static_string_ihash("CONTENT-type"), "");
+        static_assert("[@`{"_ss.ihash() == "[@`{"_ss.hash() && !"@"_ss.iequals("`"), "");
+        static_assert(L"Straße"_ss.iequals(L"STRAßE"), "");
+        const std::string runtime = "X-Forwarded-For: 203.0.113.7, CONTENT-TYPE, \xc1\xe1 [@`{ x-forwarded-for: z";
+        CHECK(header.iequals(runtime.data() + 30, 12) && !header.iequals(runtime.data() + 30, 11));
+        CHECK(header.iequals(std::string("cOnTeNt-TyPe")) && header.icompare(std::string("Content-Typf")) < 0);
+        for (size_t i = 0; i <= runtime.size(); ++i)
+            for (size_t j = i; j <= runtime.size(); ++j) {
+                const std::string part = runtime.substr(i, j - i);
+                std::string lowered = part;
+                for (char& ch : lowered)
+                    ch = ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch;
+                CHECK(static_string_ihash(part.data(), part.size()) == static_string_hash(lowered.data(), lowered.size()));
+                const std::string other = runtime.substr(runtime.size() - (j - i));
+                std::string other_lowered = other;
+                for (char& ch : other_lowered)
+                    ch = ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch;
+                const bool equal = lowered == other_lowered;
+                CHECK(__static_string_detail::iequal_runtime(part.data(), other.data(), part.size()) == equal);
+            }
+        constexpr auto headers = make_static_string_imap(
+            std::make_pair("Host"_ss, 1), std::make_pair("Content-Type"_ss, 2), std::make_pair("Content-Length"_ss, 3),
+            std::make_pair("X-Forwarded-For"_ss, 4), std::make_pair("Accept"_ss, 5));
+        static_assert(headers.contains("content-type") && !headers.contains("Content-Type"), "");
+        static_assert(headers.icontains("HOST") && headers.iindex("accept"_ss) == headers.index("accept"), "");
+        static_assert(!headers.icontains("Hosts"), "");
+        static_assert(":B"_ss.ihash() == "[A"_ss.ihash(), "");
+        constexpr auto icolliding = make_static_string_imap(std::make_pair(":B"_ss, 1), std::make_pair("[A"_ss, 2),
+            std::make_pair("Strict-Transport-Security"_ss, 3));
+        static_assert(icolliding.iindex(":b") == icolliding.index(":b") && icolliding.icontains("[a"), "");
+        CHECK(*icolliding.ifind(":B", 2) == 1 && *icolliding.ifind("[a", 2) == 2 && icolliding.ifind("[b", 2) == nullptr);
+        CHECK(*icolliding.ifind("STRICT-transport-SECURITY", 25) == 3 && !icolliding.icontains("STRICT-transport-SECURITZ", 25));
+        constexpr auto wide_headers = make_static_string_imap(std::make_pair(L"Strict-Transport-Security"_ss, 1), std::make_pair(L"Host"_ss, 2));
+        CHECK(*wide_headers.ifind(L"strict-TRANSPORT-security", 25) == 1 && *wide_headers.ifind(L"hOST", 4) == 2);
+        CHECK(headers.ifind(runtime.data(), 15) != nullptr && *headers.ifind(runtime.data(), 15) == 4);
+        CHECK(*headers.ifind("CONTENT-LENGTH", 14) == 3 && headers.ifind("CONTENT-LENGT", 13) == nullptr);
+        CHECK(headers.icontains(runtime.data() + 30, 12) && !headers.icontains("", 0));
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(header.iequals(std::string_view("content-TYPE")) && header.icompare(std::string_view("Content")) > 0);
+        CHECK(static_string_ihash(std::string_view("HOST")) == "host"_ss.hash());
+        CHECK(*headers.ifind(std::string_view("x-FORWARDED-for")) == 4 && !headers.icontains(std::string_view("Accepts")));
+#endif
+    }
+
+    { // static_string_set tests
+        constexpr auto hosts = make_static_string_set("www.example.com"_ss, "api.example.com"_ss, "www.example.org"_ss,
+            "www.example.com.evil"_ss, "a"_ss, ""_ss, "www.example"_ss, "\xc3\xa9t\xc3\xa9.fr"_ss, "zz"_ss, "b\x7f"_ss,
+            "www.example.co"_ss, "cdn.example.com"_ss);
+        static_assert(hosts.size() == 12 && !hosts.empty(), "");
+        static_assert(hosts.contains("www.example.com") && hosts.contains(""_ss) && hosts.contains("\xc3\xa9t\xc3\xa9.fr"), "");
+        static_assert(!hosts.contains("www.example.net") && !hosts.contains("www.example.c") && !hosts.contains("b"), "");
+        static_assert(hosts.index("") == 0 && hosts.index("\xc3\xa9t\xc3\xa9.fr") == (static_cast<char>(-1) < 0 ? 1 : 11), "");
+        static_assert(hosts.lower_bound("www.example.com.") == hosts.index("www.example.com.evil"), "");
+        static_assert(hosts.lower_bound("zzz") == hosts.size() && hosts.lower_bound("") == 0, "");
+        const std::vector<std::string> keys = {"www.example.com", "api.example.com", "www.example.org", "www.example.com.evil",
+            "a", "", "www.example", "\xc3\xa9t\xc3\xa9.fr", "zz", "b\x7f", "www.example.co", "cdn.example.com"};
+        std::vector<std::string> sorted = keys;
+        std::sort(sorted.begin(), sorted.end(), [](const std::string& str1, const std::string& str2) {
+            return std::lexicographical_compare(str1.begin(), str1.end(), str2.begin(), str2.end());
+        });
+        for (size_t i = 0; i < sorted.size(); ++i)
+            CHECK(std::string(hosts[i], hosts.length(i)) == sorted[i] && std::string(hosts.c_str(i)) == sorted[i]);
+        std::vector<std::string> queries = keys;
+        for (const std::string& key : keys)
+            for (size_t i = 0; i <= key.size(); ++i) {
+                queries.push_back(key.substr(0, i));
+                queries.push_back(key.substr(0, i) + "~");
+                queries.push_back(key.substr(0, i) + "\x80");
+            }
+        for (const std::string& query : queries) {
+            const size_t expected = static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), query,
+                [](const std::string& str1, const std::string& str2) {
+                    return std::lexicographical_compare(str1.begin(), str1.end(), str2.begin(), str2.end());
+                }) - sorted.begin());
+            const bool found = expected < sorted.size() && sorted[expected] == query;
+            CHECK(hosts.lower_bound(query.data(), query.size()) == expected);
+            CHECK(hosts.contains(query.data(), query.size()) == found);
+            CHECK(hosts.index(query.data(), query.size()) == (found ? expected : hosts.npos));
+        }
+        constexpr auto none = make_static_string_set<char>();
+        static_assert(none.empty() && none.lower_bound("x") == 0 && !none.contains(""), "");
+        CHECK(!none.contains("", 0));
+        constexpr auto words = make_static_string_set(L"été"_ss, L"summer"_ss, L"spring"_ss);
+        static_assert(words.index(L"spring") == 0 && words.index(L"été") == 2, "");
+        CHECK(words.contains(L"summer", 6) && !words.contains(L"sum", 3) && words.lower_bound(L"sum", 3) == 1);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(hosts.view(hosts.index("zz")) == "zz" && hosts.contains(std::string_view("a")));
+        CHECK(hosts.lower_bound(std::string_view("b")) == hosts.index("b\x7f") && hosts.index(std::string_view("c")) == hosts.npos);
+#endif
+    }
+
+    { // static_string_trie tests
+        constexpr auto routes = SSTRIE("/"_ss, "/api"_ss, "/api/v1/"_ss, "/api/v2/"_ss, "/static/"_ss, "/api/v1/users"_ss,
+            "/\xc3\xa9t\xc3\xa9"_ss, "/apiary"_ss);
+        static_assert(routes.size() == 8 && routes.capacity() <= 64 && routes.classes() == 17, "");
+        static_assert(routes.index("/api/v1/", 8) == 2 && routes.index("/api/v1", 7) == routes.npos, "");
+        static_assert(routes.contains("/", 1) && !routes.contains("", 0) && !routes.contains("/x", 2), "");
+        static_assert(routes.longest_prefix("/api/v1/users/42", 16) == 5 && routes.longest_prefix("/api/v3", 7) == 1, "");
+        static_assert(routes.longest_prefix("/static", 7) == 0 && routes.longest_prefix("static", 6) == routes.npos, "");
+        static_assert(routes.length(2) == 8 && routes[6][1] == '\xc3', "");
+        const std::vector<std::string> keys = {"/", "/api", "/api/v1/", "/api/v2/", "/static/", "/api/v1/users", "/\xc3\xa9t\xc3\xa9", "/apiary"};
+        std::vector<std::string> queries = {"", "x", "/\xc3", "/api/v1/users/", "/apiar"};
+        for (const std::string& key : keys)
+            for (size_t i = 0; i <= key.size(); ++i)
+                queries.push_back(key.substr(0, i)), queries.push_back(key.substr(0, i) + "/x");
+        for (const std::string& query : queries) {
+            size_t exact = routes.npos, longest = routes.npos, prefixed = 0;
+            for (size_t i = 0; i < keys.size(); ++i) {
+                exact = keys[i] == query ? i : exact;
+                if (query.compare(0, keys[i].size(), keys[i]) == 0 && (longest == routes.npos || keys[i].size() > keys[longest].size()))
+                    longest = i;
+                prefixed += keys[i].compare(0, query.size(), query) == 0;
+            }
+            CHECK(routes.index(query) == exact && routes.contains(query) == (exact != routes.npos));
+            CHECK(routes.longest_prefix(query) == longest);
+            std::vector<std::string> listed;
+            CHECK(routes.enumerate(query, [&](size_t index) { listed.push_back(routes[index]); }) == prefixed);
+            CHECK(listed.size() == prefixed && std::is_sorted(listed.begin(), listed.end()));
+            for (const std::string& key : listed)
+                CHECK(key.compare(0, query.size(), query) == 0);
+        }
+        constexpr auto empty = SSTRIE(""_ss, "a"_ss);
+        static_assert(empty.index("", 0) == 0 && empty.longest_prefix("b", 1) == 0 && empty.longest_prefix("ab", 2) == 1, "");
+        constexpr auto words = SSTRIE(L"été", L"ét", L"summer");
+        static_assert(words.longest_prefix(L"étés", 4) == 0 && words.index(L"ét", 2) == 1 && words.class_of(L'x') == 0, "");
+        CHECK(words.enumerate(L"é", 1, [](size_t) {}) == 2);
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        static_assert(routes.longest_prefix(std::string_view("/api/v2/x")) == 3 && routes.view(4) == "/static/", "");
+        CHECK(routes.enumerate(std::string_view("/api/v"), [](size_t index) { CHECK(index == 2 || index == 3 || index == 5); }) == 3);
+#endif
+    }
+
+    { // static_router tests
+        constexpr auto router = SSROUTER("/"_ss, "/users"_ss, "/users/new"_ss, "/users/{id:int}"_ss, "/users/{name}/posts/{post}"_ss,
+            "/users/{id:int}/posts/{post:int}"_ss, "/static/{file:path}"_ss, "/users/new/"_ss);
+        static_assert(router.size() == 8 && std::is_same<decltype(router)::match_type, static_route_match<2>>::value, "");
+        static_assert(router.param_index(4, "post") == 1 && router.param_index(4, "name") == 0 && router.param_index(4, "id") == router.npos, "");
+        static_assert(router.param_index(6, "file") == 0 && router.length(1) == 6 && router.pattern(1)[1] == 'u', "");
+        const auto check = [&](const char* path, size_t route, std::vector<std::string> params) {
+            const auto found = router.match(path, std::strlen(path));
+            CHECK(found.route == route && static_cast<bool>(found) == (route != router.npos));
+            CHECK(found.size() == (route != router.npos ? params.size() : 0));
+            for (size_t i = 0; i < found.size(); ++i)
+                CHECK(found[i].str() == params[i]);
+        };
+        check("/", 0, {});
+        check("/users", 1, {});
+        check("/users/new", 2, {});
+        check("/users/new/", 7, {});
+        check("/users/42", 3, {"42"});
+        check("/users/bob", router.npos, {});
+        check("/users/42/posts/7", 5, {"42", "7"});
+        check("/users/42/posts/x7", 4, {"42", "x7"});
+        check("/users/bob/posts/7", 4, {"bob", "7"});
+        check("/users/new/posts/7", 4, {"new", "7"});
+        check("/users//posts/7", router.npos, {});
+        check("/users/bob/posts/", router.npos, {});
+        check("/users/bob/posts", router.npos, {});
+        check("/static/css/site.css", 6, {"css/site.css"});
+        check("/static/", router.npos, {});
+        check("/static", router.npos, {});
+        check("", router.npos, {});
+        check("users", router.npos, {});
+        check("//", router.npos, {});
+        const std::string path = "/users/42/posts/1007";
+        const auto found = router.match(path);
+        CHECK(found.parse<int>(0).value == 42 && found.parse<unsigned short>(1).value == 1007);
+        CHECK(found[1] == "1007" && found[0].data == path.data() + 7);
+        int post = 0;
+        const auto handled = router(path.data(), path.size(), [] { return std::string("404"); },
+            [](const decltype(router)::match_type&) { return std::string("root"); },
+            [](const decltype(router)::match_type&) { return std::string("users"); },
+            [](const decltype(router)::match_type&) { return std::string("new user"); },
+            [](const decltype(router)::match_type& match) { return "user " + match[0].str(); },
+            [](const decltype(router)::match_type& match) { return match[0].str() + " post " + match[1].str(); },
+            [&](const decltype(router)::match_type& match) { post = match.parse<int>(1).value; return std::string("post"); },
+            [](const decltype(router)::match_type& match) { return "file " + match[0].str(); },
+            [](const decltype(router)::match_type&) { return std::string("new user/"); });
+        CHECK(handled == "post" && post == 1007);
+        constexpr auto wide = SSROUTER(L"/{lang}/index"_ss, L"/{lang:int}/index"_ss);
+        CHECK(wide.match(L"/de/index", 9).route == 0 && wide.match(L"/12/index", 9).route == 1 && !wide.match(L"/de/x", 5));
+#ifdef SNW1_STATIC_STRING_HAS_STRING_VIEW
+        CHECK(router.match(std::string_view("/users/7")).route == 3 && router.match(std::string_view("/users/7"))[0].view() == "7");
+        CHECK(router(std::string_view("/nope"), [] { return 404; }, [](auto&) { return 0; }, [](auto&) { return 1; },
+            [](auto&) { return 2; }, [](auto&) { return 3; }, [](auto&) { return 4; }, [](auto&) { return 5; },
+            [](auto&) { return 6; }, [](auto&) { return 7; }) == 404);
+#endif
+    }
+
+#ifdef SNW1_STATIC_STRING_HAS_CLASS_NTTP
+    { // class-type template parameter tests
+        static_assert(std::is_same<metric<"requests"_ss>, metric<"requests"_ss>>::value, "");
+        static_assert(std::is_same<metric<"req"_ss + "uests">, metric<"requests"_ss>>::value, "");
+        static_assert(std::is_same<metric<"requests"_ss.substring<0, 3>()>, metric<"req"_ss>>::value, "");
+        static_assert(!std::is_same<metric<"requests"_ss>, metric<"responses"_ss>>::value, "");
+        static_assert(!std::is_same<metric<"a"_ss>, metric<L"a"_ss>>::value, "");
+        static_assert(&metric<"requests"_ss>::name == &metric<"req"_ss + "uests">::name, "");
+        static_assert(&metric<"requests"_ss>::name == &"requests"_si, "");
+        static_assert(metric<"requests"_ss>::name == "requests", "");
+        static_assert(field_width<"latency"_ss>() == 7, "");
+        static_assert(field_width<ITOSS(-42)>() == 3, "");
+        constexpr auto unicode = u"Größe"_ss;
+        static_assert(std::is_same<decltype(unicode), const static_u16string_t<6>>::value, "");
+        static_assert(unicode.size() == 5 && unicode[1] == u'r' && unicode[2] == u'ö', "");
+        static_assert(""_ss.size() == 0, "");
+        CHECK(std::strcmp(metric<"requests"_ss>::name.c_str(), "requests") == 0);
+    }
+#endif
+
     // example #0
     std::cout << "Hello "_ss + "World!" << std::endl;
 